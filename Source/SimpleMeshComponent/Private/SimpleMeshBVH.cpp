@@ -0,0 +1,576 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHBVH---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHBVH---------//
+
+#include "SimpleMeshBVH.h"
+#include "SimpleMeshComponent.h"
+#include "DynamicMeshBuilder.h"
+#include "Algo/Partition.h"
+#include "Async/ParallelFor.h"
+#include "Engine/World.h"
+#include "EngineUtils.h"
+#include "HAL/IConsoleManager.h"
+#include "Math/RandomStream.h"
+#include "UObject/UObjectIterator.h"
+#include <atomic>
+
+DEFINE_LOG_CATEGORY_STATIC(LogSimpleMeshBVH, Log, All);
+
+DECLARE_CYCLE_STAT(TEXT("BVH Build"), STAT_SimpleMesh_BVHBuild, STATGROUP_SimpleMesh);
+DECLARE_CYCLE_STAT(TEXT("BVH Refit"), STAT_SimpleMesh_BVHRefit, STATGROUP_SimpleMesh);
+
+namespace SimpleMeshBVHPrivate
+{
+    static constexpr int32 NumBins = 12;
+
+    /** Below this depth SAH splits are used, deeper nodes are split in halves to bound the tree depth */
+    static constexpr int32 MaxSahDepth = 32;
+
+    /** Traversal stack, enough for MaxSahDepth plus halving any section size */
+    static constexpr int32 MaxStackSize = 96;
+
+    FORCEINLINE const FVector3f& Corner(TConstArrayView<FDynamicMeshVertex> Vertices, TConstArrayView<uint32> Indices, int32 TriIdx, int32 CornerIdx)
+    {
+        return Vertices[Indices[TriIdx * 3 + CornerIdx]].Position;
+    }
+
+    FORCEINLINE FBox3f TriangleBox(TConstArrayView<FDynamicMeshVertex> Vertices, TConstArrayView<uint32> Indices, int32 TriIdx)
+    {
+        const FVector3f& P0 = Corner(Vertices, Indices, TriIdx, 0);
+        const FVector3f& P1 = Corner(Vertices, Indices, TriIdx, 1);
+        const FVector3f& P2 = Corner(Vertices, Indices, TriIdx, 2);
+        return FBox3f(P0.ComponentMin(P1).ComponentMin(P2), P0.ComponentMax(P1).ComponentMax(P2));
+    }
+
+    FORCEINLINE float HalfArea(const FBox3f& Box)
+    {
+        const FVector3f Size = Box.Max - Box.Min;
+        return Size.X * Size.Y + Size.Y * Size.Z + Size.Z * Size.X;
+    }
+
+    /** Slab test of 3 axes at once. OutNear is where the ray enters the box. */
+    FORCEINLINE bool RayBox(const VectorRegister4Float& Origin, const VectorRegister4Float& InvDirection, const FVector3f& BoxMin, const FVector3f& BoxMax, float MaxDistance, float& OutNear)
+    {
+        const VectorRegister4Float T1 = VectorMultiply(VectorSubtract(VectorLoadFloat3(&BoxMin.X), Origin), InvDirection);
+        const VectorRegister4Float T2 = VectorMultiply(VectorSubtract(VectorLoadFloat3(&BoxMax.X), Origin), InvDirection);
+
+        alignas(16) float Near[4];
+        alignas(16) float Far[4];
+        VectorStoreAligned(VectorMin(T1, T2), Near);
+        VectorStoreAligned(VectorMax(T1, T2), Far);
+
+        OutNear = FMath::Max(FMath::Max3(Near[0], Near[1], Near[2]), 0.f);
+        return OutNear <= FMath::Min(FMath::Min3(Far[0], Far[1], Far[2]), MaxDistance);
+    }
+
+    /** Möller-Trumbore, both faces */
+    FORCEINLINE bool RayTriangle(const FVector3f& Origin, const FVector3f& Direction, const FVector3f& P0, const FVector3f& P1, const FVector3f& P2, float& InOutDistance, float& OutU, float& OutV)
+    {
+        const FVector3f Edge1 = P1 - P0;
+        const FVector3f Edge2 = P2 - P0;
+        const FVector3f PVec = Direction ^ Edge2;
+        const float Det = Edge1 | PVec;
+        if (FMath::Abs(Det) < UE_SMALL_NUMBER)
+        {
+            return false;
+        }
+
+        const float InvDet = 1.f / Det;
+        const FVector3f TVec = Origin - P0;
+        const float U = (TVec | PVec) * InvDet;
+        if (U < 0.f || U > 1.f)
+        {
+            return false;
+        }
+
+        const FVector3f QVec = TVec ^ Edge1;
+        const float V = (Direction | QVec) * InvDet;
+        if (V < 0.f || U + V > 1.f)
+        {
+            return false;
+        }
+
+        const float Distance = (Edge2 | QVec) * InvDet;
+        if (Distance < 0.f || Distance > InOutDistance)
+        {
+            return false;
+        }
+
+        InOutDistance = Distance;
+        OutU = U;
+        OutV = V;
+        return true;
+    }
+
+    /** Separating axis test of a triangle against a box (Akenine-Möller) */
+    static bool TriangleBoxOverlap(const FVector3f& Center, const FVector3f& HalfSize, const FVector3f& InP0, const FVector3f& InP1, const FVector3f& InP2)
+    {
+        const FVector3f P[3] = { InP0 - Center, InP1 - Center, InP2 - Center };
+        const FVector3f Edges[3] = { P[1] - P[0], P[2] - P[1], P[0] - P[2] };
+
+        // Box faces
+        for (int32 Axis = 0; Axis < 3; Axis++)
+        {
+            if (FMath::Min3(P[0][Axis], P[1][Axis], P[2][Axis]) > HalfSize[Axis] || FMath::Max3(P[0][Axis], P[1][Axis], P[2][Axis]) < -HalfSize[Axis])
+            {
+                return false;
+            }
+        }
+
+        // Triangle plane
+        const FVector3f Normal = Edges[0] ^ Edges[1];
+        const float PlaneRadius = HalfSize.X * FMath::Abs(Normal.X) + HalfSize.Y * FMath::Abs(Normal.Y) + HalfSize.Z * FMath::Abs(Normal.Z);
+        if (FMath::Abs(Normal | P[0]) > PlaneRadius)
+        {
+            return false;
+        }
+
+        // Box axes crossed with triangle edges
+        static const FVector3f BoxAxes[3] = { FVector3f::ForwardVector, FVector3f::RightVector, FVector3f::UpVector };
+        for (const FVector3f& Edge : Edges)
+        {
+            for (const FVector3f& BoxAxis : BoxAxes)
+            {
+                const FVector3f Axis = BoxAxis ^ Edge;
+                const float D0 = Axis | P[0];
+                const float D1 = Axis | P[1];
+                const float D2 = Axis | P[2];
+                const float Radius = HalfSize.X * FMath::Abs(Axis.X) + HalfSize.Y * FMath::Abs(Axis.Y) + HalfSize.Z * FMath::Abs(Axis.Z);
+                if (FMath::Min3(D0, D1, D2) > Radius || FMath::Max3(D0, D1, D2) < -Radius)
+                {
+                    return false;
+                }
+            }
+        }
+
+        return true;
+    }
+}
+
+using namespace SimpleMeshBVHPrivate;
+
+struct FSimpleMeshBVH::FBuildContext
+{
+    TArray<FBox3f> Boxes;
+    TArray<FVector3f> Centroids;
+    std::atomic<int32> NumNodes{ 1 };
+};
+
+void FSimpleMeshBVH::Build(TConstArrayView<FDynamicMeshVertex> Vertices, TConstArrayView<uint32> Indices)
+{
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_BVHBuild);
+
+    Nodes.Reset();
+    Triangles.Reset();
+
+    const int32 NumTriangles = Indices.Num() / 3;
+    const uint32 NumVertices = (uint32)Vertices.Num();
+    for (int32 TriIdx = 0; TriIdx < NumTriangles; TriIdx++)
+    {
+        if (Indices[TriIdx * 3 + 0] < NumVertices && Indices[TriIdx * 3 + 1] < NumVertices && Indices[TriIdx * 3 + 2] < NumVertices)
+        {
+            Triangles.Add(TriIdx);
+        }
+    }
+
+    if (Triangles.Num() == 0)
+    {
+        return;
+    }
+
+    FBuildContext Context;
+    Context.Boxes.SetNumUninitialized(NumTriangles);
+    Context.Centroids.SetNumUninitialized(NumTriangles);
+    ParallelFor(Triangles.Num(), [&](int32 Idx)
+    {
+        const int32 TriIdx = Triangles[Idx];
+        Context.Boxes[TriIdx] = TriangleBox(Vertices, Indices, TriIdx);
+        Context.Centroids[TriIdx] = Context.Boxes[TriIdx].GetCenter();
+    });
+
+    // A binary tree with N leaves at most has 2N - 1 nodes, workers claim children from this array
+    Nodes.SetNumUninitialized(Triangles.Num() * 2 - 1);
+    BuildNode(Context, 0, 0, Triangles.Num(), 0);
+    Nodes.SetNum(Context.NumNodes.load(), false);
+}
+
+void FSimpleMeshBVH::BuildNode(FBuildContext& Context, int32 NodeIndex, int32 First, int32 Count, int32 Depth)
+{
+    FBox3f Bounds(ForceInit);
+    FBox3f CentroidBounds(ForceInit);
+    for (int32 Idx = First; Idx < First + Count; Idx++)
+    {
+        Bounds += Context.Boxes[Triangles[Idx]];
+        CentroidBounds += Context.Centroids[Triangles[Idx]];
+    }
+
+    FNode& Node = Nodes[NodeIndex];
+    Node.Min = Bounds.Min;
+    Node.Max = Bounds.Max;
+    Node.Index = First;
+    Node.Count = Count;
+
+    if (Count <= MaxLeafTriangles)
+    {
+        return;
+    }
+
+    // Binned SAH over the three axes
+    int32 BestAxis = INDEX_NONE;
+    int32 BestSplit = INDEX_NONE;
+    float BestCost = UE_MAX_FLT;
+    const FVector3f CentroidExtent = CentroidBounds.Max - CentroidBounds.Min;
+
+    if (Depth < MaxSahDepth)
+    {
+        for (int32 Axis = 0; Axis < 3; Axis++)
+        {
+            if (CentroidExtent[Axis] <= UE_KINDA_SMALL_NUMBER)
+            {
+                continue;
+            }
+
+            FBox3f BinBoxes[NumBins];
+            int32 BinCounts[NumBins] = {};
+            for (FBox3f& BinBox : BinBoxes)
+            {
+                BinBox.Init();
+            }
+
+            const float Scale = NumBins / CentroidExtent[Axis];
+            for (int32 Idx = First; Idx < First + Count; Idx++)
+            {
+                const int32 TriIdx = Triangles[Idx];
+                const int32 Bin = FMath::Min((int32)((Context.Centroids[TriIdx][Axis] - CentroidBounds.Min[Axis]) * Scale), NumBins - 1);
+                BinBoxes[Bin] += Context.Boxes[TriIdx];
+                BinCounts[Bin]++;
+            }
+
+            // Sweep from the right, then from the left evaluating every split plane
+            float RightAreas[NumBins];
+            int32 RightCounts[NumBins];
+            FBox3f RightBox(ForceInit);
+            int32 RightCount = 0;
+            for (int32 Bin = NumBins - 1; Bin > 0; Bin--)
+            {
+                if (BinCounts[Bin] > 0)
+                {
+                    RightBox += BinBoxes[Bin];
+                    RightCount += BinCounts[Bin];
+                }
+                RightAreas[Bin] = RightBox.IsValid ? HalfArea(RightBox) : 0.f;
+                RightCounts[Bin] = RightCount;
+            }
+
+            FBox3f LeftBox(ForceInit);
+            int32 LeftCount = 0;
+            for (int32 Split = 1; Split < NumBins; Split++)
+            {
+                if (BinCounts[Split - 1] > 0)
+                {
+                    LeftBox += BinBoxes[Split - 1];
+                    LeftCount += BinCounts[Split - 1];
+                }
+
+                if (LeftCount > 0 && RightCounts[Split] > 0)
+                {
+                    const float Cost = LeftCount * HalfArea(LeftBox) + RightCounts[Split] * RightAreas[Split];
+                    if (Cost < BestCost)
+                    {
+                        BestCost = Cost;
+                        BestAxis = Axis;
+                        BestSplit = Split;
+                    }
+                }
+            }
+        }
+    }
+
+    int32 Mid = First + Count / 2;
+    if (BestAxis != INDEX_NONE)
+    {
+        // Splitting must beat intersecting every triangle of the node
+        const float NodeArea = HalfArea(Bounds);
+        if (NodeArea > 0.f && 1.f + BestCost / NodeArea >= Count && Count <= 4 * MaxLeafTriangles)
+        {
+            return;
+        }
+
+        const float Scale = NumBins / CentroidExtent[BestAxis];
+        const float MinCentroid = CentroidBounds.Min[BestAxis];
+        const int32 NumLeft = Algo::Partition(Triangles.GetData() + First, Count, [&Context, BestAxis, BestSplit, Scale, MinCentroid](int32 TriIdx)
+        {
+            return FMath::Min((int32)((Context.Centroids[TriIdx][BestAxis] - MinCentroid) * Scale), NumBins - 1) < BestSplit;
+        });
+
+        if (NumLeft > 0 && NumLeft < Count)
+        {
+            Mid = First + NumLeft;
+        }
+    }
+
+    const int32 Children = Context.NumNodes.fetch_add(2);
+    Node.Index = Children;
+    Node.Count = 0;
+
+    if (Count > ParallelBuildThreshold)
+    {
+        ParallelFor(2, [this, &Context, Children, First, Mid, Count, Depth](int32 Child)
+        {
+            if (Child == 0)
+            {
+                BuildNode(Context, Children, First, Mid - First, Depth + 1);
+            }
+            else
+            {
+                BuildNode(Context, Children + 1, Mid, First + Count - Mid, Depth + 1);
+            }
+        });
+    }
+    else
+    {
+        BuildNode(Context, Children, First, Mid - First, Depth + 1);
+        BuildNode(Context, Children + 1, Mid, First + Count - Mid, Depth + 1);
+    }
+}
+
+void FSimpleMeshBVH::Refit(TConstArrayView<FDynamicMeshVertex> Vertices, TConstArrayView<uint32> Indices)
+{
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_BVHRefit);
+
+    // Leaves are independent
+    ParallelFor(Nodes.Num(), [this, Vertices, Indices](int32 NodeIndex)
+    {
+        FNode& Node = Nodes[NodeIndex];
+        if (Node.Count > 0)
+        {
+            FBox3f Bounds(ForceInit);
+            for (int32 Idx = Node.Index; Idx < Node.Index + Node.Count; Idx++)
+            {
+                Bounds += TriangleBox(Vertices, Indices, Triangles[Idx]);
+            }
+            Node.Min = Bounds.Min;
+            Node.Max = Bounds.Max;
+        }
+    });
+
+    // Children are always allocated after their parent, walking backward sees them first
+    for (int32 NodeIndex = Nodes.Num() - 1; NodeIndex >= 0; NodeIndex--)
+    {
+        FNode& Node = Nodes[NodeIndex];
+        if (Node.Count == 0)
+        {
+            const FNode& Left = Nodes[Node.Index];
+            const FNode& Right = Nodes[Node.Index + 1];
+            Node.Min = Left.Min.ComponentMin(Right.Min);
+            Node.Max = Left.Max.ComponentMax(Right.Max);
+        }
+    }
+}
+
+bool FSimpleMeshBVH::Raycast(TConstArrayView<FDynamicMeshVertex> Vertices, TConstArrayView<uint32> Indices, const FVector3f& Origin, const FVector3f& Direction, float MaxDistance, FSimpleMeshBVHHit& OutHit) const
+{
+    if (Nodes.Num() == 0)
+    {
+        return false;
+    }
+
+    // Keep the slabs finite on axis aligned rays
+    const FVector3f SafeDirection(
+        FMath::Abs(Direction.X) > UE_SMALL_NUMBER ? Direction.X : FMath::Sign(Direction.X + UE_SMALL_NUMBER) * UE_SMALL_NUMBER,
+        FMath::Abs(Direction.Y) > UE_SMALL_NUMBER ? Direction.Y : FMath::Sign(Direction.Y + UE_SMALL_NUMBER) * UE_SMALL_NUMBER,
+        FMath::Abs(Direction.Z) > UE_SMALL_NUMBER ? Direction.Z : FMath::Sign(Direction.Z + UE_SMALL_NUMBER) * UE_SMALL_NUMBER);
+    const FVector3f InvDirection = FVector3f(1.f) / SafeDirection;
+    const VectorRegister4Float OriginReg = VectorLoadFloat3(&Origin.X);
+    const VectorRegister4Float InvDirectionReg = VectorLoadFloat3_W1(&InvDirection.X);
+
+    float BestDistance = MaxDistance;
+    int32 BestTriangle = INDEX_NONE;
+    float BestU = 0.f;
+    float BestV = 0.f;
+
+    int32 Stack[MaxStackSize];
+    float StackNear[MaxStackSize];
+    int32 StackSize = 0;
+
+    float RootNear;
+    if (RayBox(OriginReg, InvDirectionReg, Nodes[0].Min, Nodes[0].Max, BestDistance, RootNear))
+    {
+        Stack[StackSize] = 0;
+        StackNear[StackSize++] = RootNear;
+    }
+
+    while (StackSize > 0)
+    {
+        --StackSize;
+        if (StackNear[StackSize] > BestDistance)
+        {
+            continue;
+        }
+
+        const FNode& Node = Nodes[Stack[StackSize]];
+        if (Node.Count > 0)
+        {
+            for (int32 Idx = Node.Index; Idx < Node.Index + Node.Count; Idx++)
+            {
+                const int32 TriIdx = Triangles[Idx];
+                float U, V;
+                if (RayTriangle(Origin, Direction, Corner(Vertices, Indices, TriIdx, 0), Corner(Vertices, Indices, TriIdx, 1), Corner(Vertices, Indices, TriIdx, 2), BestDistance, U, V))
+                {
+                    BestTriangle = TriIdx;
+                    BestU = U;
+                    BestV = V;
+                }
+            }
+            continue;
+        }
+
+        float LeftNear, RightNear;
+        const bool bHitLeft = RayBox(OriginReg, InvDirectionReg, Nodes[Node.Index].Min, Nodes[Node.Index].Max, BestDistance, LeftNear);
+        const bool bHitRight = RayBox(OriginReg, InvDirectionReg, Nodes[Node.Index + 1].Min, Nodes[Node.Index + 1].Max, BestDistance, RightNear);
+
+        // Push the far child first so the near one is popped next
+        if (bHitLeft && bHitRight)
+        {
+            const bool bLeftFirst = LeftNear <= RightNear;
+            Stack[StackSize] = bLeftFirst ? Node.Index + 1 : Node.Index;
+            StackNear[StackSize++] = bLeftFirst ? RightNear : LeftNear;
+            Stack[StackSize] = bLeftFirst ? Node.Index : Node.Index + 1;
+            StackNear[StackSize++] = bLeftFirst ? LeftNear : RightNear;
+        }
+        else if (bHitLeft || bHitRight)
+        {
+            Stack[StackSize] = bHitLeft ? Node.Index : Node.Index + 1;
+            StackNear[StackSize++] = bHitLeft ? LeftNear : RightNear;
+        }
+        check(StackSize <= MaxStackSize - 2);
+    }
+
+    if (BestTriangle == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const FVector3f& P0 = Corner(Vertices, Indices, BestTriangle, 0);
+    const FVector3f& P1 = Corner(Vertices, Indices, BestTriangle, 1);
+    const FVector3f& P2 = Corner(Vertices, Indices, BestTriangle, 2);
+
+    OutHit.Distance = BestDistance;
+    OutHit.TriangleIndex = BestTriangle;
+    OutHit.U = BestU;
+    OutHit.V = BestV;
+    OutHit.Normal = ((P1 - P2) ^ (P0 - P2)).GetSafeNormal();
+    return true;
+}
+
+void FSimpleMeshBVH::OverlapBox(TConstArrayView<FDynamicMeshVertex> Vertices, TConstArrayView<uint32> Indices, const FBox3f& Box, TArray<int32>& OutTriangles) const
+{
+    if (Nodes.Num() == 0)
+    {
+        return;
+    }
+
+    const FVector3f Center = Box.GetCenter();
+    const FVector3f HalfSize = Box.GetExtent();
+
+    int32 Stack[MaxStackSize];
+    int32 StackSize = 0;
+    Stack[StackSize++] = 0;
+
+    while (StackSize > 0)
+    {
+        const FNode& Node = Nodes[Stack[--StackSize]];
+        if (Node.Min.X > Box.Max.X || Node.Max.X < Box.Min.X
+            || Node.Min.Y > Box.Max.Y || Node.Max.Y < Box.Min.Y
+            || Node.Min.Z > Box.Max.Z || Node.Max.Z < Box.Min.Z)
+        {
+            continue;
+        }
+
+        if (Node.Count > 0)
+        {
+            for (int32 Idx = Node.Index; Idx < Node.Index + Node.Count; Idx++)
+            {
+                const int32 TriIdx = Triangles[Idx];
+                if (TriangleBoxOverlap(Center, HalfSize, Corner(Vertices, Indices, TriIdx, 0), Corner(Vertices, Indices, TriIdx, 1), Corner(Vertices, Indices, TriIdx, 2)))
+                {
+                    OutTriangles.Add(TriIdx);
+                }
+            }
+        }
+        else
+        {
+            check(StackSize <= MaxStackSize - 2);
+            Stack[StackSize++] = Node.Index + 1;
+            Stack[StackSize++] = Node.Index;
+        }
+    }
+}
+
+FBox3f FSimpleMeshBVH::GetBounds() const
+{
+    return Nodes.Num() > 0 ? FBox3f(Nodes[0].Min, Nodes[0].Max) : FBox3f(ForceInit);
+}
+
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+
+/** Compare BVH raycasts with physics line traces on every SimpleMeshComponent of the game worlds */
+static FAutoConsoleCommandWithWorldAndArgs GSimpleMeshBVHBenchmarkCmd(
+    TEXT("SimpleMesh.BVH.Benchmark"),
+    TEXT("Time N random rays (default 10000) against each SimpleMeshComponent, BVH queries versus physics line traces"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        const int32 NumRays = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 10000;
+        FRandomStream Random(0x5EED);
+
+        for (TObjectIterator<USimpleMeshComponent> It; It; ++It)
+        {
+            USimpleMeshComponent* Component = *It;
+            if (!IsValid(Component) || Component->GetWorld() != World || !Component->IsRegistered())
+            {
+                continue;
+            }
+
+            const FBox Box = Component->Bounds.GetBox();
+            const float Radius = Component->Bounds.SphereRadius * 2.f;
+            TArray<TPair<FVector, FVector>> Rays;
+            Rays.Reserve(NumRays);
+            for (int32 RayIdx = 0; RayIdx < NumRays; RayIdx++)
+            {
+                const FVector Target = Random.RandPointInBox(Box);
+                const FVector Start = Target - Random.GetUnitVector() * Radius;
+                Rays.Emplace(Start, Start + (Target - Start) * 2.0);
+            }
+
+            // Build the section BVHs outside of the timings
+            FSimpleMeshQueryHit WarmupHit;
+            Component->RaycastSections(Rays[0].Key, Rays[0].Value, WarmupHit, false);
+
+            int32 BVHHits = 0;
+            const double BVHStart = FPlatformTime::Seconds();
+            for (const TPair<FVector, FVector>& Ray : Rays)
+            {
+                FSimpleMeshQueryHit Hit;
+                BVHHits += Component->RaycastSections(Ray.Key, Ray.Value, Hit, false) ? 1 : 0;
+            }
+            const double BVHTime = FPlatformTime::Seconds() - BVHStart;
+
+            int32 PhysicsHits = 0;
+            const FCollisionQueryParams Params(SCENE_QUERY_STAT(SimpleMeshBVHBenchmark), true);
+            const double PhysicsStart = FPlatformTime::Seconds();
+            for (const TPair<FVector, FVector>& Ray : Rays)
+            {
+                FHitResult Hit;
+                PhysicsHits += Component->LineTraceComponent(Hit, Ray.Key, Ray.Value, Params) ? 1 : 0;
+            }
+            const double PhysicsTime = FPlatformTime::Seconds() - PhysicsStart;
+
+            UE_LOG(LogSimpleMeshBVH, Display, TEXT("%s: %d rays, BVH %.3f ms (%d hits), physics %.3f ms (%d hits)"),
+                *Component->GetPathName(), NumRays, BVHTime * 1000.0, BVHHits, PhysicsTime * 1000.0, PhysicsHits);
+        }
+    }));
+
+#endif
@@ -0,0 +1,202 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHBUFFERPOOL---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHBUFFERPOOL---------//
+
+#include "SimpleMeshBufferPool.h"
+#include "SimpleMeshComponent.h"
+#include "DynamicMeshBuilder.h"
+#include "RenderingThread.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSimpleMeshBufferPool, Log, All);
+
+DECLARE_MEMORY_STAT(TEXT("Pooled Buffer Memory"), STAT_SimpleMesh_PooledBufferMemory, STATGROUP_SimpleMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Buffer Pool Hits"), STAT_SimpleMesh_BufferPoolHits, STATGROUP_SimpleMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Buffer Pool Misses"), STAT_SimpleMesh_BufferPoolMisses, STATGROUP_SimpleMesh);
+
+static int32 GSimpleMeshBufferPoolMaxPooledMB = 64;
+static FAutoConsoleVariableRef CVarSimpleMeshBufferPoolMaxPooledMB(
+    TEXT("SimpleMesh.BufferPool.MaxPooledMB"),
+    GSimpleMeshBufferPoolMaxPooledMB,
+    TEXT("Memory of released SimpleMesh vertex/index buffers kept for reuse. 0 disables the pool."));
+
+static FAutoConsoleCommand CmdSimpleMeshBufferPoolStats(
+    TEXT("SimpleMesh.BufferPool.Stats"),
+    TEXT("Print the counters of the SimpleMesh GPU buffer pool."),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        ENQUEUE_RENDER_COMMAND(SimpleMeshBufferPoolStats)([](FRHICommandListImmediate&)
+        {
+            const FSimpleMeshBufferPoolStats Stats = FSimpleMeshBufferPool::Get().GetStats();
+            UE_LOG(LogSimpleMeshBufferPool, Display, TEXT("Hits %d, Misses %d, Discards %d, Pooled %d buffers / %.2f MB (peak %.2f MB)"),
+                Stats.Hits, Stats.Misses, Stats.Discards, Stats.NumPooled, Stats.PooledBytes / (1024.0 * 1024.0), Stats.PeakPooledBytes / (1024.0 * 1024.0));
+        });
+    }));
+
+static FAutoConsoleCommand CmdSimpleMeshBufferPoolTrim(
+    TEXT("SimpleMesh.BufferPool.Trim"),
+    TEXT("Free every buffer held by the SimpleMesh GPU buffer pool."),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        ENQUEUE_RENDER_COMMAND(SimpleMeshBufferPoolTrim)([](FRHICommandListImmediate&)
+        {
+            FSimpleMeshBufferPool::Get().Trim();
+        });
+    }));
+
+FSimpleMeshBufferPool& FSimpleMeshBufferPool::Get()
+{
+    static TGlobalResource<FSimpleMeshBufferPool> Pool;
+    return Pool;
+}
+
+uint32 FSimpleMeshBufferPool::GetBucketSize(uint32 Size)
+{
+    // 1 KB minimum, then 4 buckets per power of two: at most 25% wasted
+    Size = FMath::Max(Size, 1024u);
+    const uint32 Octave = 1u << FMath::FloorLog2(Size);
+    const uint32 Step = FMath::Max(Octave / 4, 1u);
+    return FMath::DivideAndRoundUp(Size, Step) * Step;
+}
+
+FBufferRHIRef FSimpleMeshBufferPool::Acquire(FRHICommandListBase& RHICmdList, EBufferUsageFlags Usage, uint32 Stride, uint32 Size, const TCHAR* DebugName)
+{
+    check(IsInRenderingThread());
+
+    const FBucketKey Key{ Usage, Stride, GetBucketSize(Size) };
+
+    if (TArray<FBufferRHIRef>* Bucket = FreeBuffers.Find(Key))
+    {
+        if (Bucket->Num() > 0)
+        {
+            FBufferRHIRef Buffer = Bucket->Pop(false);
+            Stats.Hits++;
+            Stats.NumPooled--;
+            Stats.PooledBytes -= Key.Size;
+            INC_DWORD_STAT(STAT_SimpleMesh_BufferPoolHits);
+            DEC_MEMORY_STAT_BY(STAT_SimpleMesh_PooledBufferMemory, Key.Size);
+            return Buffer;
+        }
+    }
+
+    Stats.Misses++;
+    INC_DWORD_STAT(STAT_SimpleMesh_BufferPoolMisses);
+
+    FRHIResourceCreateInfo CreateInfo(DebugName);
+    return RHICmdList.CreateBuffer(Key.Size, Usage, Stride, ERHIAccess::VertexOrIndexBuffer, CreateInfo);
+}
+
+void FSimpleMeshBufferPool::Release(FBufferRHIRef& Buffer)
+{
+    check(IsInRenderingThread());
+
+    if (!Buffer.IsValid())
+    {
+        return;
+    }
+
+    const FBucketKey Key{ Buffer->GetUsage(), Buffer->GetStride(), Buffer->GetSize() };
+
+    // Only buffers this pool sized can go back to it, and nothing once the pool was released at RHI shutdown
+    const uint64 MaxPooledBytes = (uint64)FMath::Max(GSimpleMeshBufferPoolMaxPooledMB, 0) * 1024 * 1024;
+    if (!IsInitialized() || Key.Size != GetBucketSize(Key.Size) || Stats.PooledBytes + Key.Size > MaxPooledBytes)
+    {
+        Stats.Discards++;
+        Buffer.SafeRelease();
+        return;
+    }
+
+    FreeBuffers.FindOrAdd(Key).Add(MoveTemp(Buffer));
+    Buffer = nullptr;
+    Stats.NumPooled++;
+    Stats.PooledBytes += Key.Size;
+    Stats.PeakPooledBytes = FMath::Max(Stats.PeakPooledBytes, Stats.PooledBytes);
+    INC_MEMORY_STAT_BY(STAT_SimpleMesh_PooledBufferMemory, Key.Size);
+}
+
+void FSimpleMeshBufferPool::Trim()
+{
+    check(IsInRenderingThread());
+
+    FreeBuffers.Empty();
+    DEC_MEMORY_STAT_BY(STAT_SimpleMesh_PooledBufferMemory, Stats.PooledBytes);
+    Stats.NumPooled = 0;
+    Stats.PooledBytes = 0;
+}
+
+void FSimpleMeshBufferPool::ReleaseRHI()
+{
+    Trim();
+}
+
+void FSimpleMeshPooledPositionBuffer::Init(const TArray<FDynamicMeshVertex>& Vertices)
+{
+    NumVertices = Vertices.Num();
+    Positions.SetNumUninitialized(NumVertices);
+    for (uint32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+    {
+        Positions[VertIdx] = Vertices[VertIdx].Position;
+    }
+}
+
+void FSimpleMeshPooledPositionBuffer::Bind(FLocalVertexFactory::FDataType& Data) const
+{
+    Data.PositionComponent = FVertexStreamComponent(this, 0, sizeof(FVector3f), VET_Float3);
+    Data.PositionComponentSRV = PositionSRV;
+}
+
+void FSimpleMeshPooledPositionBuffer::InitRHI(FRHICommandListBase& RHICmdList)
+{
+    if (NumVertices == 0)
+    {
+        return;
+    }
+
+    const uint32 NumBytes = NumVertices * sizeof(FVector3f);
+    VertexBufferRHI = FSimpleMeshBufferPool::Get().Acquire(RHICmdList, BUF_Static | BUF_VertexBuffer | BUF_ShaderResource, 0, NumBytes, TEXT("FSimpleMeshPooledPositionBuffer"));
+
+    if (Positions.Num() == (int32)NumVertices)
+    {
+        void* Data = RHILockBuffer(VertexBufferRHI, 0, NumBytes, RLM_WriteOnly);
+        FMemory::Memcpy(Data, Positions.GetData(), NumBytes);
+        RHIUnlockBuffer(VertexBufferRHI);
+        Positions.Empty();
+    }
+
+    if (RHISupportsManualVertexFetch(GMaxRHIShaderPlatform))
+    {
+        PositionSRV = RHICreateShaderResourceView(VertexBufferRHI, sizeof(float), PF_R32_FLOAT);
+    }
+}
+
+void FSimpleMeshPooledPositionBuffer::ReleaseRHI()
+{
+    PositionSRV.SafeRelease();
+    FSimpleMeshBufferPool::Get().Release(VertexBufferRHI);
+    FVertexBuffer::ReleaseRHI();
+}
+
+void FSimpleMeshPooledIndexBuffer::InitRHI(FRHICommandListBase& RHICmdList)
+{
+    if (Indices.Num() == 0)
+    {
+        return;
+    }
+
+    const uint32 NumBytes = Indices.Num() * sizeof(uint32);
+    IndexBufferRHI = FSimpleMeshBufferPool::Get().Acquire(RHICmdList, BUF_Static | BUF_IndexBuffer, sizeof(uint32), NumBytes, TEXT("FSimpleMeshPooledIndexBuffer"));
+
+    void* Data = RHILockBuffer(IndexBufferRHI, 0, NumBytes, RLM_WriteOnly);
+    FMemory::Memcpy(Data, Indices.GetData(), NumBytes);
+    RHIUnlockBuffer(IndexBufferRHI);
+    Indices.Empty();
+}
+
+void FSimpleMeshPooledIndexBuffer::ReleaseRHI()
+{
+    FSimpleMeshBufferPool::Get().Release(IndexBufferRHI);
+    FIndexBuffer::ReleaseRHI();
+}
@@ -0,0 +1,226 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHBUILDER---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHBUILDER---------//
+
+#include "SimpleMeshBuilder.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSimpleMeshBuilder, Log, All);
+
+void USimpleMeshBuilder::Reset()
+{
+    Section.Reset();
+}
+
+void USimpleMeshBuilder::Reserve(int32 NumVertices, int32 NumTriangles)
+{
+    Section.VertexBuffer.Reserve(Section.VertexBuffer.Num() + FMath::Max(NumVertices, 0));
+    Section.IndexBuffer.Reserve(Section.IndexBuffer.Num() + FMath::Max(NumTriangles, 0) * 3);
+}
+
+int32 USimpleMeshBuilder::AddVertexInternal(const FVector3f& Position, const FVector3f& Normal, const FVector2f& UV, const FColor& Color)
+{
+    FDynamicMeshVertex& Vertex = Section.VertexBuffer.AddDefaulted_GetRef();
+    Vertex.Position = Position;
+    Vertex.TextureCoordinate[0] = UV;
+    Vertex.Color = Color;
+
+    FVector3f TangentX, TangentY;
+    Normal.FindBestAxisVectors(TangentX, TangentY);
+    Vertex.SetTangents(TangentX, TangentY, Normal);
+
+    Section.SectionLocalBox += FVector(Position);
+    return Section.VertexBuffer.Num() - 1;
+}
+
+void USimpleMeshBuilder::AddQuadIndices(int32 A, int32 B, int32 C, int32 D)
+{
+    // Same winding as the generated normals: (P1 - P2) ^ (P0 - P2) points to the front
+    Section.IndexBuffer.Append({ (uint32)A, (uint32)C, (uint32)B, (uint32)A, (uint32)D, (uint32)C });
+}
+
+int32 USimpleMeshBuilder::AddVertex(FVector Position, FVector Normal, FVector2D UV, FLinearColor Color)
+{
+    return AddVertexInternal(FVector3f(Position), FVector3f(Normal.GetSafeNormal(UE_SMALL_NUMBER, FVector::UpVector)), FVector2f(UV), Color.ToFColor(false));
+}
+
+void USimpleMeshBuilder::AddTriangle(int32 A, int32 B, int32 C)
+{
+    const int32 NumVertices = Section.VertexBuffer.Num();
+    if (A < 0 || B < 0 || C < 0 || A >= NumVertices || B >= NumVertices || C >= NumVertices)
+    {
+        UE_LOG(LogSimpleMeshBuilder, Warning, TEXT("AddTriangle: index out of range (%d, %d, %d), %d vertices."), A, B, C, NumVertices);
+        return;
+    }
+    Section.IndexBuffer.Append({ (uint32)A, (uint32)B, (uint32)C });
+}
+
+int32 USimpleMeshBuilder::AddQuad(FVector A, FVector B, FVector C, FVector D)
+{
+    const FVector3f Normal = FVector3f((B - A) ^ (D - A)).GetSafeNormal();
+    const FColor White = FColor::White;
+
+    const int32 First = AddVertexInternal(FVector3f(A), Normal, FVector2f(0.f, 0.f), White);
+    AddVertexInternal(FVector3f(B), Normal, FVector2f(1.f, 0.f), White);
+    AddVertexInternal(FVector3f(C), Normal, FVector2f(1.f, 1.f), White);
+    AddVertexInternal(FVector3f(D), Normal, FVector2f(0.f, 1.f), White);
+    AddQuadIndices(First, First + 1, First + 2, First + 3);
+    return First;
+}
+
+void USimpleMeshBuilder::AddGrid(FVector Origin, FVector AxisX, FVector AxisY, int32 NumX, int32 NumY)
+{
+    if (NumX <= 0 || NumY <= 0)
+    {
+        return;
+    }
+
+    const FVector3f Normal = FVector3f(AxisX ^ AxisY).GetSafeNormal();
+    const int32 RowSize = NumX + 1;
+    Reserve(RowSize * (NumY + 1), NumX * NumY * 2);
+
+    const int32 First = Section.VertexBuffer.Num();
+    for (int32 Y = 0; Y <= NumY; Y++)
+    {
+        const float V = (float)Y / NumY;
+        for (int32 X = 0; X <= NumX; X++)
+        {
+            const float U = (float)X / NumX;
+            AddVertexInternal(FVector3f(Origin + AxisX * U + AxisY * V), Normal, FVector2f(U, V), FColor::White);
+        }
+    }
+
+    for (int32 Y = 0; Y < NumY; Y++)
+    {
+        for (int32 X = 0; X < NumX; X++)
+        {
+            const int32 A = First + Y * RowSize + X;
+            AddQuadIndices(A, A + 1, A + RowSize + 1, A + RowSize);
+        }
+    }
+}
+
+void USimpleMeshBuilder::AddBox(FVector Center, FVector Extent)
+{
+    Reserve(24, 12);
+
+    for (int32 Axis = 0; Axis < 3; Axis++)
+    {
+        for (const double Sign : { 1.0, -1.0 })
+        {
+            FVector Normal = FVector::ZeroVector;
+            FVector U = FVector::ZeroVector;
+            FVector V = FVector::ZeroVector;
+            Normal[Axis] = Sign;
+            U[(Axis + 1) % 3] = Extent[(Axis + 1) % 3];
+            V[(Axis + 2) % 3] = Extent[(Axis + 2) % 3];
+            if (Sign < 0.0)
+            {
+                Swap(U, V); // keeps U ^ V along the normal
+            }
+
+            const FVector FaceCenter = Center + Normal * Extent[Axis];
+            AddQuad(FaceCenter - U - V, FaceCenter + U - V, FaceCenter + U + V, FaceCenter - U + V);
+        }
+    }
+}
+
+void USimpleMeshBuilder::AddExtrusion(const TArray<FVector2D>& Profile, FVector Base, float Height, bool bCapEnds)
+{
+    const int32 NumPoints = Profile.Num();
+    if (NumPoints < 3)
+    {
+        UE_LOG(LogSimpleMeshBuilder, Warning, TEXT("AddExtrusion: the profile needs at least 3 points, got %d."), NumPoints);
+        return;
+    }
+
+    const FVector Up(0.0, 0.0, Height);
+    Reserve(NumPoints * (bCapEnds ? 6 : 4), NumPoints * 2 + (bCapEnds ? (NumPoints - 2) * 2 : 0));
+
+    // Walls: one quad per edge, hard edges
+    for (int32 PointIdx = 0; PointIdx < NumPoints; PointIdx++)
+    {
+        const FVector P0 = Base + FVector(Profile[PointIdx], 0.0);
+        const FVector P1 = Base + FVector(Profile[(PointIdx + 1) % NumPoints], 0.0);
+        AddQuad(P0, P1, P1 + Up, P0 + Up);
+    }
+
+    if (!bCapEnds)
+    {
+        return;
+    }
+
+    FBox2D ProfileBox(Profile);
+    const FVector2D ProfileSize = ProfileBox.GetSize().ComponentMax(FVector2D(UE_SMALL_NUMBER));
+    for (const bool bTop : { false, true })
+    {
+        const FVector3f Normal(0.f, 0.f, bTop ? 1.f : -1.f);
+        const int32 First = Section.VertexBuffer.Num();
+        for (const FVector2D& Point : Profile)
+        {
+            const FVector2D UV = (Point - ProfileBox.Min) / ProfileSize;
+            AddVertexInternal(FVector3f(Base + FVector(Point, 0.0) + (bTop ? Up : FVector::ZeroVector)), Normal, FVector2f(UV), FColor::White);
+        }
+
+        // Fan from the first point, the profile goes counter clockwise around +Z
+        for (int32 PointIdx = 1; PointIdx < NumPoints - 1; PointIdx++)
+        {
+            const uint32 B = First + PointIdx;
+            const uint32 C = First + PointIdx + 1;
+            if (bTop)
+            {
+                Section.IndexBuffer.Append({ (uint32)First, C, B });
+            }
+            else
+            {
+                Section.IndexBuffer.Append({ (uint32)First, B, C });
+            }
+        }
+    }
+}
+
+void USimpleMeshBuilder::AppendMesh(const TArray<FVector>& Vertices, const TArray<int32>& Triangles)
+{
+    if (Triangles.Num() % 3 != 0)
+    {
+        UE_LOG(LogSimpleMeshBuilder, Warning, TEXT("AppendMesh: %d indices is not a multiple of 3."), Triangles.Num());
+        return;
+    }
+
+    for (const int32 Index : Triangles)
+    {
+        if (Index < 0 || Index >= Vertices.Num())
+        {
+            UE_LOG(LogSimpleMeshBuilder, Warning, TEXT("AppendMesh: index %d out of range, %d vertices. The mesh is dropped."), Index, Vertices.Num());
+            return;
+        }
+    }
+
+    const int32 First = Section.VertexBuffer.Num();
+    Reserve(Vertices.Num(), Triangles.Num() / 3);
+
+    for (const FVector& Vertex : Vertices)
+    {
+        AddVertexInternal(FVector3f(Vertex), FVector3f::UpVector, FVector2f::ZeroVector, FColor::White);
+    }
+
+    for (const int32 Index : Triangles)
+    {
+        Section.IndexBuffer.Add((uint32)(First + Index));
+    }
+    Section.bGenerateNormals = true;
+}
+
+void USimpleMeshBuilder::CommitToSection(USimpleMeshComponent* Component, int32 SectionIndex, UMaterialInterface* Material, bool bSectionVisible, bool bCreateCollision)
+{
+    if (!Component)
+    {
+        UE_LOG(LogSimpleMeshBuilder, Warning, TEXT("CommitToSection called without a component."));
+        return;
+    }
+
+    Component->CommitMeshSection(SectionIndex, MoveTemp(Section), Material, bSectionVisible, bCreateCollision);
+    Section.Reset();
+}
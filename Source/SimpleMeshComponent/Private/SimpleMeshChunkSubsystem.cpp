@@ -0,0 +1,328 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHCHUNKSUBSYSTEM---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHCHUNKSUBSYSTEM---------//
+
+#include "SimpleMeshChunkSubsystem.h"
+#include "SimpleMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/PlatformTime.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SimpleMeshChunkSubsystem)
+
+DECLARE_CYCLE_STAT(TEXT("Chunk Streaming"), STAT_SimpleMesh_ChunkStreaming, STATGROUP_SimpleMesh);
+DECLARE_CYCLE_STAT(TEXT("Chunk Generation"), STAT_SimpleMesh_ChunkGeneration, STATGROUP_SimpleMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Loaded Chunks"), STAT_SimpleMesh_LoadedChunks, STATGROUP_SimpleMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pooled Chunk Components"), STAT_SimpleMesh_PooledChunks, STATGROUP_SimpleMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Pending Chunks"), STAT_SimpleMesh_PendingChunks, STATGROUP_SimpleMesh);
+
+void USimpleMeshChunkSubsystem::Deinitialize()
+{
+    // Components belong to the host actor, the world tears them down
+    LoadedChunks.Empty();
+    ComponentPool.Empty();
+    PendingChunks.Empty();
+    PendingChunkSet.Empty();
+    HostActor = nullptr;
+
+    Super::Deinitialize();
+}
+
+TStatId USimpleMeshChunkSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(USimpleMeshChunkSubsystem, STATGROUP_Tickables);
+}
+
+bool USimpleMeshChunkSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void USimpleMeshChunkSubsystem::SetChunkGenerator(const FSimpleMeshChunkGenerator& Generator)
+{
+    ChunkGenerator = Generator;
+    if (!ChunkGenerator.IsBound())
+    {
+        ReleaseAllChunks();
+    }
+    LastViewerChunks.Reset();
+}
+
+void USimpleMeshChunkSubsystem::AddViewer(AActor* Viewer)
+{
+    if (Viewer)
+    {
+        Viewers.AddUnique(Viewer);
+    }
+}
+
+void USimpleMeshChunkSubsystem::RemoveViewer(AActor* Viewer)
+{
+    Viewers.Remove(Viewer);
+}
+
+void USimpleMeshChunkSubsystem::RequestChunkRebuild(FIntVector ChunkCoord)
+{
+    // Same queue as the missing chunks: nearest first, within the frame budget
+    if (LoadedChunks.Contains(ChunkCoord) && !PendingChunkSet.Contains(ChunkCoord))
+    {
+        PendingChunkSet.Add(ChunkCoord);
+        PendingChunks.Add(ChunkCoord);
+        bSortPendingChunks = true;
+    }
+}
+
+USimpleMeshComponent* USimpleMeshChunkSubsystem::GetChunkComponent(FIntVector ChunkCoord) const
+{
+    const TObjectPtr<USimpleMeshComponent>* Component = LoadedChunks.Find(ChunkCoord);
+    return Component ? Component->Get() : nullptr;
+}
+
+FIntVector USimpleMeshChunkSubsystem::WorldToChunk(const FVector& WorldLocation) const
+{
+    return FIntVector(
+        FMath::FloorToInt(WorldLocation.X / ChunkSize),
+        FMath::FloorToInt(WorldLocation.Y / ChunkSize),
+        bVerticalChunks ? FMath::FloorToInt(WorldLocation.Z / ChunkSize) : 0);
+}
+
+FVector USimpleMeshChunkSubsystem::ChunkToWorld(FIntVector ChunkCoord) const
+{
+    return FVector(ChunkCoord) * ChunkSize;
+}
+
+void USimpleMeshChunkSubsystem::GatherViewerLocations(TArray<FVector>& OutLocations) const
+{
+    UWorld* World = GetWorld();
+    for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+    {
+        const APlayerController* PlayerController = It->Get();
+        if (PlayerController && PlayerController->IsLocalController())
+        {
+            FVector Location;
+            FRotator Rotation;
+            PlayerController->GetPlayerViewPoint(Location, Rotation);
+            OutLocations.Add(Location);
+        }
+    }
+
+    for (const TWeakObjectPtr<AActor>& Viewer : Viewers)
+    {
+        if (const AActor* ViewerActor = Viewer.Get())
+        {
+            OutLocations.Add(ViewerActor->GetActorLocation());
+        }
+    }
+}
+
+int32 USimpleMeshChunkSubsystem::GetChunkDistance(const FIntVector& ChunkCoord, TConstArrayView<FIntVector> ViewerChunks) const
+{
+    int32 Distance = MAX_int32;
+    for (const FIntVector& ViewerChunk : ViewerChunks)
+    {
+        const FIntVector Delta = ChunkCoord - ViewerChunk;
+        Distance = FMath::Min(Distance, FMath::Max3(FMath::Abs(Delta.X), FMath::Abs(Delta.Y), FMath::Abs(Delta.Z)));
+    }
+    return Distance;
+}
+
+void USimpleMeshChunkSubsystem::QueueMissingChunks(TConstArrayView<FIntVector> ViewerChunks)
+{
+    const int32 RadiusZ = bVerticalChunks ? LoadRadius : 0;
+    for (const FIntVector& ViewerChunk : ViewerChunks)
+    {
+        for (int32 Z = -RadiusZ; Z <= RadiusZ; Z++)
+        {
+            for (int32 Y = -LoadRadius; Y <= LoadRadius; Y++)
+            {
+                for (int32 X = -LoadRadius; X <= LoadRadius; X++)
+                {
+                    const FIntVector ChunkCoord = ViewerChunk + FIntVector(X, Y, Z);
+                    if (!LoadedChunks.Contains(ChunkCoord) && !PendingChunkSet.Contains(ChunkCoord))
+                    {
+                        PendingChunkSet.Add(ChunkCoord);
+                        PendingChunks.Add(ChunkCoord);
+                    }
+                }
+            }
+        }
+    }
+}
+
+void USimpleMeshChunkSubsystem::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_ChunkStreaming);
+
+    Super::Tick(DeltaTime);
+
+    if (!ChunkGenerator.IsBound())
+    {
+        return;
+    }
+
+    Viewers.RemoveAll([](const TWeakObjectPtr<AActor>& Viewer) { return !Viewer.IsValid(); });
+
+    TArray<FVector> ViewerLocations;
+    GatherViewerLocations(ViewerLocations);
+
+    TArray<FIntVector> ViewerChunks;
+    for (const FVector& Location : ViewerLocations)
+    {
+        ViewerChunks.AddUnique(WorldToChunk(Location));
+    }
+
+    // The grid only changes when a viewer crosses a chunk border
+    if (ViewerChunks != LastViewerChunks)
+    {
+        LastViewerChunks = ViewerChunks;
+
+        TArray<FIntVector> FarChunks;
+        for (const TPair<FIntVector, TObjectPtr<USimpleMeshComponent>>& Chunk : LoadedChunks)
+        {
+            if (GetChunkDistance(Chunk.Key, ViewerChunks) > FMath::Max(UnloadRadius, LoadRadius))
+            {
+                FarChunks.Add(Chunk.Key);
+            }
+        }
+        for (const FIntVector& ChunkCoord : FarChunks)
+        {
+            ReleaseChunk(ChunkCoord);
+        }
+
+        QueueMissingChunks(ViewerChunks);
+        bSortPendingChunks = true;
+    }
+
+    // Nearest first, generation pops from the end
+    if (bSortPendingChunks)
+    {
+        PendingChunks.Sort([this, &ViewerChunks](const FIntVector& A, const FIntVector& B)
+        {
+            return GetChunkDistance(A, ViewerChunks) > GetChunkDistance(B, ViewerChunks);
+        });
+        bSortPendingChunks = false;
+    }
+
+    const double EndTime = FPlatformTime::Seconds() + FrameBudgetMs * 0.001;
+    bool bFirst = true;
+    while (PendingChunks.Num() > 0 && (bFirst || FPlatformTime::Seconds() < EndTime))
+    {
+        const FIntVector ChunkCoord = PendingChunks.Pop(false);
+        PendingChunkSet.Remove(ChunkCoord);
+
+        // The viewers may have moved away since the chunk was queued. Loaded chunks stay up to UnloadRadius, their rebuilds too.
+        TObjectPtr<USimpleMeshComponent>* Loaded = LoadedChunks.Find(ChunkCoord);
+        if (GetChunkDistance(ChunkCoord, ViewerChunks) > (Loaded ? FMath::Max(UnloadRadius, LoadRadius) : LoadRadius))
+        {
+            continue;
+        }
+
+        SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_ChunkGeneration);
+
+        USimpleMeshComponent* Component = Loaded ? Loaded->Get() : AcquireComponent(ChunkCoord);
+        if (Component == nullptr)
+        {
+            break;
+        }
+
+        LoadedChunks.Add(ChunkCoord, Component);
+        ChunkGenerator.Execute(ChunkCoord, Component);
+        bFirst = false;
+    }
+
+    SET_DWORD_STAT(STAT_SimpleMesh_LoadedChunks, LoadedChunks.Num());
+    SET_DWORD_STAT(STAT_SimpleMesh_PooledChunks, ComponentPool.Num());
+    SET_DWORD_STAT(STAT_SimpleMesh_PendingChunks, PendingChunks.Num());
+}
+
+AActor* USimpleMeshChunkSubsystem::GetOrCreateHostActor()
+{
+    if (HostActor == nullptr)
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.ObjectFlags = RF_Transient;
+        HostActor = GetWorld()->SpawnActor<AActor>(SpawnParams);
+        if (HostActor)
+        {
+            USceneComponent* Root = NewObject<USceneComponent>(HostActor, TEXT("Root"));
+            Root->SetMobility(EComponentMobility::Static);
+            HostActor->SetRootComponent(Root);
+            Root->RegisterComponent();
+#if WITH_EDITOR
+            HostActor->SetActorLabel(TEXT("SimpleMeshChunks"));
+#endif
+        }
+    }
+    return HostActor;
+}
+
+USimpleMeshComponent* USimpleMeshChunkSubsystem::AcquireComponent(const FIntVector& ChunkCoord)
+{
+    USimpleMeshComponent* Component = nullptr;
+    while (Component == nullptr && ComponentPool.Num() > 0)
+    {
+        Component = ComponentPool.Pop(false);
+    }
+
+    if (Component)
+    {
+        Component->SetWorldLocation(ChunkToWorld(ChunkCoord));
+        Component->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+        Component->SetVisibility(true);
+        return Component;
+    }
+
+    AActor* Host = GetOrCreateHostActor();
+    if (Host == nullptr)
+    {
+        return nullptr;
+    }
+
+    Component = NewObject<USimpleMeshComponent>(Host, NAME_None, RF_Transient);
+    Component->SetupAttachment(Host->GetRootComponent());
+    Component->SetWorldLocation(ChunkToWorld(ChunkCoord));
+    Component->RegisterComponent();
+    return Component;
+}
+
+void USimpleMeshChunkSubsystem::ReleaseChunk(const FIntVector& ChunkCoord)
+{
+    TObjectPtr<USimpleMeshComponent> Component;
+    if (!LoadedChunks.RemoveAndCopyValue(ChunkCoord, Component) || Component == nullptr)
+    {
+        return;
+    }
+
+    OnChunkReleased.Broadcast(ChunkCoord, Component);
+
+    if (ComponentPool.Num() < MaxPooledComponents)
+    {
+        // Sections stay allocated so the next chunk reuses their memory
+        Component->SetVisibility(false);
+        Component->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+        ComponentPool.Add(Component);
+    }
+    else
+    {
+        Component->DestroyComponent();
+    }
+}
+
+void USimpleMeshChunkSubsystem::ReleaseAllChunks()
+{
+    TArray<FIntVector> ChunkCoords;
+    LoadedChunks.GetKeys(ChunkCoords);
+    for (const FIntVector& ChunkCoord : ChunkCoords)
+    {
+        ReleaseChunk(ChunkCoord);
+    }
+
+    PendingChunks.Reset();
+    PendingChunkSet.Reset();
+    bSortPendingChunks = false;
+    LastViewerChunks.Reset();
+}
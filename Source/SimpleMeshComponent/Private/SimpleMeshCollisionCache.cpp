@@ -0,0 +1,364 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHCOLLISIONCACHE---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHCOLLISIONCACHE---------//
+
+#include "SimpleMeshCollisionCache.h"
+#include "SimpleMeshComponent.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Interfaces/Interface_CollisionDataProvider.h"
+#include "Chaos/ChaosArchive.h"
+#include "Hash/xxhash.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "Misc/EngineVersion.h"
+#include "HAL/FileManager.h"
+#include "Serialization/CustomVersion.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Async/Async.h"
+#include <atomic>
+
+DEFINE_LOG_CATEGORY_STATIC(LogSimpleMeshCollisionCache, Log, All);
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Collision Cache Memory Hits"), STAT_SimpleMesh_CollisionCacheMemoryHits, STATGROUP_SimpleMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Collision Cache Disk Hits"), STAT_SimpleMesh_CollisionCacheDiskHits, STATGROUP_SimpleMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Collision Cache Misses"), STAT_SimpleMesh_CollisionCacheMisses, STATGROUP_SimpleMesh);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Collision Cache Entries"), STAT_SimpleMesh_CollisionCacheEntries, STATGROUP_SimpleMesh);
+
+static int32 GSimpleMeshCollisionCacheMaxEntries = 512;
+static FAutoConsoleVariableRef CVarSimpleMeshCollisionCacheMaxEntries(
+    TEXT("SimpleMesh.CollisionCache.MaxMemoryEntries"),
+    GSimpleMeshCollisionCacheMaxEntries,
+    TEXT("Number of cooked collision meshes kept in memory by the SimpleMesh collision cache. 0 disables the memory cache."));
+
+static bool GSimpleMeshCollisionCacheUseDisk = true;
+static FAutoConsoleVariableRef CVarSimpleMeshCollisionCacheUseDisk(
+    TEXT("SimpleMesh.CollisionCache.UseDisk"),
+    GSimpleMeshCollisionCacheUseDisk,
+    TEXT("Read and write cooked SimpleMesh collision in Saved/SimpleMeshCollisionCache."));
+
+static int32 GSimpleMeshCollisionCacheMaxDiskMB = 256;
+static FAutoConsoleVariableRef CVarSimpleMeshCollisionCacheMaxDiskMB(
+    TEXT("SimpleMesh.CollisionCache.MaxDiskMB"),
+    GSimpleMeshCollisionCacheMaxDiskMB,
+    TEXT("Size limit of Saved/SimpleMeshCollisionCache in megabytes, the least recently used entries are deleted past it. 0 for no limit."));
+
+static FAutoConsoleCommand CmdSimpleMeshCollisionCacheStats(
+    TEXT("SimpleMesh.CollisionCache.Stats"),
+    TEXT("Print the hit/miss counters of the SimpleMesh collision cache."),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        const FSimpleMeshCollisionCacheStats& Stats = FSimpleMeshCollisionCache::Get().GetStats();
+        UE_LOG(LogSimpleMeshCollisionCache, Display, TEXT("Memory hits: %d, disk hits: %d, misses: %d, stores: %d"),
+            Stats.MemoryHits, Stats.DiskHits, Stats.Misses, Stats.Stores);
+    }));
+
+static FAutoConsoleCommand CmdSimpleMeshCollisionCacheClear(
+    TEXT("SimpleMesh.CollisionCache.Clear"),
+    TEXT("Drop the cooked collision held in memory by the SimpleMesh collision cache."),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        FSimpleMeshCollisionCache::Get().ClearMemory();
+    }));
+
+/** Version of the cached data, bump LatestVersion when the way geometry is hashed, cooked or stored changes */
+struct FSimpleMeshCollisionCacheVersion
+{
+    enum Type
+    {
+        Initial = 0,
+        /** Files carry the custom versions their cooked data was written with */
+        StoreCustomVersions,
+
+        VersionPlusOne,
+        LatestVersion = VersionPlusOne - 1
+    };
+
+    static const FGuid GUID;
+};
+
+const FGuid FSimpleMeshCollisionCacheVersion::GUID(0x5B1C7E3A, 0x41D24F96, 0x8A0E6C57, 0x2F94D813);
+static FCustomVersionRegistration GRegisterSimpleMeshCollisionCacheVersion(FSimpleMeshCollisionCacheVersion::GUID, FSimpleMeshCollisionCacheVersion::LatestVersion, TEXT("SimpleMeshCollisionCacheVer"));
+
+static constexpr uint32 CollisionCacheMagic = 0x43434D53; // 'SMCC'
+
+/** The disk cache is trimmed on the first write of a session, then every this many writes */
+static constexpr uint32 CollisionCacheTrimInterval = 64;
+
+FSimpleMeshCollisionCache& FSimpleMeshCollisionCache::Get()
+{
+    static FSimpleMeshCollisionCache Instance;
+    return Instance;
+}
+
+uint64 FSimpleMeshCollisionCache::ComputeGeometryHash(const FTriMeshCollisionData& CollisionData, uint32 CookFlags)
+{
+    if (CollisionData.Vertices.Num() == 0 || CollisionData.Indices.Num() == 0)
+    {
+        return 0;
+    }
+
+    const int32 CacheVersion = FSimpleMeshCollisionCacheVersion::LatestVersion;
+    FXxHash64Builder Builder;
+    Builder.Update(&FSimpleMeshCollisionCacheVersion::GUID, sizeof(FGuid));
+    Builder.Update(&CacheVersion, sizeof(CacheVersion));
+    Builder.Update(&CookFlags, sizeof(CookFlags));
+    Builder.Update(CollisionData.Vertices.GetData(), CollisionData.Vertices.Num() * sizeof(FVector3f));
+    Builder.Update(CollisionData.Indices.GetData(), CollisionData.Indices.Num() * sizeof(FTriIndices));
+    Builder.Update(CollisionData.MaterialIndices.GetData(), CollisionData.MaterialIndices.Num() * sizeof(uint16));
+
+    const uint64 Hash = Builder.Finalize().Hash;
+    return Hash != 0 ? Hash : 1;
+}
+
+bool FSimpleMeshCollisionCache::TryApply(uint64 GeometryHash, UBodySetup* BodySetup)
+{
+    check(IsInGameThread());
+
+    // Simple convex elements still have to be cooked, the cache only covers the trimesh
+    if (GeometryHash == 0 || BodySetup == nullptr || BodySetup->AggGeom.ConvexElems.Num() > 0)
+    {
+        return false;
+    }
+
+    TArray<FSimpleMeshTriMeshPtr> TriMeshes;
+    if (const TArray<FSimpleMeshTriMeshPtr>* Found = Entries.Find(GeometryHash))
+    {
+        TriMeshes = *Found;
+        EntryOrder.Remove(GeometryHash);
+        EntryOrder.Add(GeometryHash);
+        Stats.MemoryHits++;
+        INC_DWORD_STAT(STAT_SimpleMesh_CollisionCacheMemoryHits);
+    }
+    else if (GSimpleMeshCollisionCacheUseDisk && LoadFromDisk(GeometryHash, TriMeshes))
+    {
+        AddToMemory(GeometryHash, TriMeshes);
+        Stats.DiskHits++;
+        INC_DWORD_STAT(STAT_SimpleMesh_CollisionCacheDiskHits);
+    }
+    else
+    {
+        Stats.Misses++;
+        INC_DWORD_STAT(STAT_SimpleMesh_CollisionCacheMisses);
+        return false;
+    }
+
+    // Cooked geometry is immutable once built, body setups can share it
+    BodySetup->ClearPhysicsMeshes();
+    BodySetup->TriMeshGeometries = MoveTemp(TriMeshes);
+    BodySetup->bCreatedPhysicsMeshes = true;
+    BodySetup->bFailedToCreatePhysicsMeshes = false;
+    return true;
+}
+
+void FSimpleMeshCollisionCache::Store(uint64 GeometryHash, const UBodySetup* BodySetup)
+{
+    check(IsInGameThread());
+
+    if (GeometryHash == 0 || BodySetup == nullptr || BodySetup->TriMeshGeometries.Num() == 0 || Entries.Contains(GeometryHash))
+    {
+        return;
+    }
+
+    Stats.Stores++;
+    AddToMemory(GeometryHash, BodySetup->TriMeshGeometries);
+
+    if (GSimpleMeshCollisionCacheUseDisk)
+    {
+        SaveToDisk(GeometryHash, BodySetup->TriMeshGeometries);
+
+        if (NumDiskStores++ % CollisionCacheTrimInterval == 0)
+        {
+            TrimDisk();
+        }
+    }
+}
+
+void FSimpleMeshCollisionCache::ClearMemory()
+{
+    Entries.Empty();
+    EntryOrder.Empty();
+    SET_DWORD_STAT(STAT_SimpleMesh_CollisionCacheEntries, 0);
+}
+
+void FSimpleMeshCollisionCache::AddToMemory(uint64 GeometryHash, const TArray<FSimpleMeshTriMeshPtr>& TriMeshes)
+{
+    if (GSimpleMeshCollisionCacheMaxEntries <= 0)
+    {
+        return;
+    }
+
+    if (!Entries.Contains(GeometryHash))
+    {
+        EntryOrder.Add(GeometryHash);
+    }
+    Entries.Add(GeometryHash, TriMeshes);
+
+    // Least recently used entries go first, anything still used by a body setup stays alive through its own reference
+    while (EntryOrder.Num() > GSimpleMeshCollisionCacheMaxEntries)
+    {
+        Entries.Remove(EntryOrder[0]);
+        EntryOrder.RemoveAt(0, 1, false);
+    }
+
+    SET_DWORD_STAT(STAT_SimpleMesh_CollisionCacheEntries, Entries.Num());
+}
+
+FString FSimpleMeshCollisionCache::GetCacheDirectory()
+{
+    return FPaths::ProjectSavedDir() / TEXT("SimpleMeshCollisionCache");
+}
+
+FString FSimpleMeshCollisionCache::GetCacheFilename(uint64 GeometryHash)
+{
+    return GetCacheDirectory() / FString::Printf(TEXT("%016llx.smcc"), GeometryHash);
+}
+
+bool FSimpleMeshCollisionCache::LoadFromDisk(uint64 GeometryHash, TArray<FSimpleMeshTriMeshPtr>& OutTriMeshes) const
+{
+    const FString Filename = GetCacheFilename(GeometryHash);
+    TArray<uint8> Bytes;
+    if (!FFileHelper::LoadFileToArray(Bytes, *Filename, FILEREAD_Silent))
+    {
+        return false;
+    }
+
+    FMemoryReader Reader(Bytes);
+    uint32 Magic = 0;
+    uint32 EngineChangelist = 0;
+    uint64 StoredHash = 0;
+    Reader << Magic << EngineChangelist << StoredHash;
+
+    if (Magic != CollisionCacheMagic || EngineChangelist != FEngineVersion::Current().GetChangelist() || StoredHash != GeometryHash)
+    {
+        return false;
+    }
+
+    // Cooked Chaos data is only valid for the versions that wrote it, the changelist alone is 0 on source builds
+    FCustomVersionContainer Versions;
+    Versions.Serialize(Reader);
+    if (Reader.IsError() || !Versions.GetVersion(FSimpleMeshCollisionCacheVersion::GUID))
+    {
+        return false;
+    }
+    for (const FCustomVersion& Version : Versions.GetAllVersions())
+    {
+        const TOptional<FCustomVersion> Current = FCurrentCustomVersions::Get(Version.Key);
+        if (!Current.IsSet() || Current->Version != Version.Version)
+        {
+            return false;
+        }
+    }
+    Reader.SetCustomVersions(Versions);
+
+    Chaos::FChaosArchive ChaosAr(Reader);
+    ChaosAr << OutTriMeshes;
+
+    if (Reader.IsError() || OutTriMeshes.Num() == 0)
+    {
+        UE_LOG(LogSimpleMeshCollisionCache, Warning, TEXT("Discarding unreadable collision cache entry %016llx."), GeometryHash);
+        OutTriMeshes.Reset();
+        return false;
+    }
+
+    // The modification time doubles as the last use when trimming the cache
+    IFileManager::Get().SetTimeStamp(*Filename, FDateTime::UtcNow());
+    return true;
+}
+
+void FSimpleMeshCollisionCache::SaveToDisk(uint64 GeometryHash, const TArray<FSimpleMeshTriMeshPtr>& TriMeshes) const
+{
+    // Serialize here while nothing else can touch the entry, only the file write goes wide
+    TArray<uint8> Payload;
+    FMemoryWriter PayloadWriter(Payload);
+    PayloadWriter.UsingCustomVersion(FSimpleMeshCollisionCacheVersion::GUID);
+
+    TArray<FSimpleMeshTriMeshPtr> Copy = TriMeshes;
+    Chaos::FChaosArchive ChaosAr(PayloadWriter);
+    ChaosAr << Copy;
+
+    // The payload is written first so the header can list every custom version the cooked data used
+    TArray<uint8> Bytes;
+    FMemoryWriter Writer(Bytes);
+    uint32 Magic = CollisionCacheMagic;
+    uint32 EngineChangelist = FEngineVersion::Current().GetChangelist();
+    uint64 StoredHash = GeometryHash;
+    Writer << Magic << EngineChangelist << StoredHash;
+
+    FCustomVersionContainer Versions = PayloadWriter.GetCustomVersions();
+    Versions.Serialize(Writer);
+    Bytes.Append(Payload);
+
+    Async(EAsyncExecution::ThreadPool, [Filename = GetCacheFilename(GeometryHash), Bytes = MoveTemp(Bytes)]()
+    {
+        if (!FFileHelper::SaveArrayToFile(Bytes, *Filename))
+        {
+            UE_LOG(LogSimpleMeshCollisionCache, Verbose, TEXT("Could not write collision cache entry %s."), *Filename);
+        }
+    });
+}
+
+void FSimpleMeshCollisionCache::TrimDisk() const
+{
+    const int64 MaxBytes = int64(GSimpleMeshCollisionCacheMaxDiskMB) * 1024 * 1024;
+    if (MaxBytes <= 0)
+    {
+        return;
+    }
+
+    // One trim at a time, the next write past the interval will catch up
+    static std::atomic<bool> bTrimInFlight(false);
+    if (bTrimInFlight.exchange(true))
+    {
+        return;
+    }
+
+    Async(EAsyncExecution::ThreadPool, [Directory = GetCacheDirectory(), MaxBytes]()
+    {
+        struct FCacheFile
+        {
+            FString Filename;
+            int64 Size;
+            FDateTime LastUse;
+        };
+
+        TArray<FCacheFile> Files;
+        int64 TotalBytes = 0;
+        IFileManager::Get().IterateDirectoryStat(*Directory, [&Files, &TotalBytes](const TCHAR* Filename, const FFileStatData& StatData)
+        {
+            if (!StatData.bIsDirectory && FPaths::GetExtension(Filename) == TEXT("smcc"))
+            {
+                Files.Add({ Filename, StatData.FileSize, StatData.ModificationTime });
+                TotalBytes += StatData.FileSize;
+            }
+            return true;
+        });
+
+        if (TotalBytes > MaxBytes)
+        {
+            Files.Sort([](const FCacheFile& A, const FCacheFile& B) { return A.LastUse < B.LastUse; });
+
+            int32 NumDeleted = 0;
+            for (const FCacheFile& File : Files)
+            {
+                if (TotalBytes <= MaxBytes)
+                {
+                    break;
+                }
+                if (IFileManager::Get().Delete(*File.Filename, false, false, true))
+                {
+                    TotalBytes -= File.Size;
+                    NumDeleted++;
+                }
+            }
+
+            UE_LOG(LogSimpleMeshCollisionCache, Verbose, TEXT("Trimmed %d collision cache entries, %lld bytes left."), NumDeleted, TotalBytes);
+        }
+
+        bTrimInFlight = false;
+    });
+}
@@ -10,6 +10,19 @@
 
 #include "SimpleMeshComponent.h"
 #include "SimpleMeshProxy.h"
+#include "SimpleMeshNormals.h"
+#include "SimpleMeshWeld.h"
+#include "SimpleMeshSimplify.h"
+#include "SimpleMeshVoxel.h"
+#include "SimpleMeshOccluder.h"
+#include "SimpleMeshSnapshot.h"
+#include "SimpleMeshBuilder.h"
+#include "Containers/Ticker.h"
+#include "Hash/xxhash.h"
+#include "Misc/Compression.h"
+#include "SimpleMeshSerialization.h"
+#include "SimpleMeshCollisionCache.h"
+#include "SimpleMeshCookScheduler.h"
 #include "BodySetupEnums.h"
 #include "PrimitiveViewRelevance.h"
 #include "PrimitiveSceneProxy.h"
@@ -25,10 +38,57 @@
 #include "SceneInterface.h"
 #include "StaticMeshResources.h"
 #include "RayTracingInstance.h"
+#include "Async/ParallelFor.h"
+#include "Async/Async.h"
+#include "HAL/IConsoleManager.h"
+#include "UObject/UObjectIterator.h"
 
 #include UE_INLINE_GENERATED_CPP_BY_NAME(SimpleMeshComponent)
 DEFINE_LOG_CATEGORY_STATIC(LogSimpleComponent, Log, All);
 
+DECLARE_CYCLE_STAT(TEXT("Create SimpleMesh Proxy"), STAT_SimpleMesh_CreateSceneProxy, STATGROUP_SimpleMesh);
+DECLARE_CYCLE_STAT(TEXT("Update Collision"), STAT_SimpleMesh_UpdateCollision, STATGROUP_SimpleMesh);
+DECLARE_CYCLE_STAT(TEXT("Deform Section"), STAT_SimpleMesh_DeformSection, STATGROUP_SimpleMesh);
+DECLARE_CYCLE_STAT(TEXT("Update Vertex Range"), STAT_SimpleMesh_UpdateVertexRange, STATGROUP_SimpleMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Unchanged Section Updates Skipped"), STAT_SimpleMesh_SkippedUpdates, STATGROUP_SimpleMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Position Only Section Updates"), STAT_SimpleMesh_PositionOnlyUpdates, STATGROUP_SimpleMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Hidden Sections Evicted"), STAT_SimpleMesh_SectionEvictions, STATGROUP_SimpleMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Hidden Sections Restored"), STAT_SimpleMesh_SectionRestores, STATGROUP_SimpleMesh);
+DECLARE_MEMORY_STAT(TEXT("CPU Geometry Released (total)"), STAT_SimpleMesh_ReleasedGeometry, STATGROUP_SimpleMesh);
+
+static FAutoConsoleCommand GSimpleMeshMemoryCmd(
+    TEXT("SimpleMesh.Memory"),
+    TEXT("Log the CPU memory held by the sections of every SimpleMeshComponent, and what their retention policy freed"),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        int64 TotalAllocated = 0;
+        int64 TotalReleased = 0;
+        for (TObjectIterator<USimpleMeshComponent> It; It; ++It)
+        {
+            int64 Allocated, Released;
+            It->GetSectionsMemory(Allocated, Released);
+            TotalAllocated += Allocated;
+            TotalReleased += Released;
+            if (Allocated > 0 || Released > 0)
+            {
+                UE_LOG(LogTemp, Display, TEXT("%s: %.2f MB held, %.2f MB released"), *It->GetPathName(), Allocated / (1024.0 * 1024.0), Released / (1024.0 * 1024.0));
+            }
+        }
+        UE_LOG(LogTemp, Display, TEXT("SimpleMesh sections: %.2f MB held, %.2f MB released"), TotalAllocated / (1024.0 * 1024.0), TotalReleased / (1024.0 * 1024.0));
+    }));
+
+static int32 GSimpleMeshProxyParallelSectionThreshold = 8;
+static FAutoConsoleVariableRef CVarSimpleMeshProxyParallelSectionThreshold(
+    TEXT("SimpleMesh.Proxy.ParallelSectionThreshold"),
+    GSimpleMeshProxyParallelSectionThreshold,
+    TEXT("Scene proxies with at least this many sections prepare them in parallel. 0 always prepares them on the game thread."));
+
+static float GSimpleMeshOccluderDeformDelay = 0.25f;
+static FAutoConsoleVariableRef CVarSimpleMeshOccluderDeformDelay(
+    TEXT("SimpleMesh.OccluderDeformDelay"),
+    GSimpleMeshOccluderDeformDelay,
+    TEXT("Seconds between occluder rebuilds while sections are being deformed. Topology changes rebuild it right away."));
+
 #define LOCTEXT_NAMESPACE "FSimpleMeshComponentModule"
 
 void FSimpleMeshComponentModule::StartupModule() {}
@@ -63,8 +123,23 @@ IMPLEMENT_MODULE(FSimpleMeshComponentModule, SimpleMeshComponent)
 
 USimpleMeshComponent::USimpleMeshComponent(const FObjectInitializer& ObjectInitializer)
     : Super(ObjectInitializer)
+    , LocalBounds(ForceInit)
 {
     bUseComplexAsSimpleCollision = true;
+    bUseCollisionCache = true;
+    bAutoGenerateConvexCollision = false;
+    bWeldVertices = false;
+    WeldTolerance = 0.01f;
+    NumWeldedVertices = 0;
+    OccluderMaxTriangles = 512;
+    OccluderMinTriangleArea = 2500.f;
+    DefaultSectionRetention = ESimpleMeshSectionRetention::KeepAll;
+    bPublishSectionSnapshots = false;
+    ShadowMeshCellSize = 0.f;
+    CollisionSimplifyError = 0.f;
+    bReleaseHiddenSections = false;
+    HiddenSectionReleaseDelay = 10.f;
+    bCompressHiddenSections = false;
 }
 
 void USimpleMeshComponent::PostLoad()
@@ -75,21 +150,269 @@ void USimpleMeshComponent::PostLoad()
     {
         SimpleMeshBodySetup->SetFlags(RF_Public | RF_ArchetypeObject);
     }
+
+    // Sections may have been restored by Serialize
+    UpdateLocalBounds();
+}
+
+void USimpleMeshComponent::Serialize(FArchive& Ar)
+{
+    Super::Serialize(Ar);
+
+    Ar.UsingCustomVersion(FSimpleMeshCustomVersion::GUID);
+    if (Ar.IsLoading() && Ar.CustomVer(FSimpleMeshCustomVersion::GUID) < FSimpleMeshCustomVersion::SerializedSectionBlob)
+    {
+        return;
+    }
+
+    // Reference gathering and memory counting have no use for the geometry
+    if (Ar.IsObjectReferenceCollector() || Ar.IsCountingMemory())
+    {
+        return;
+    }
+
+    bool bHasSections = bSerializeMeshSections;
+    Ar << bHasSections;
+    if (!bHasSections)
+    {
+        return;
+    }
+
+    TArray<uint8> Blob;
+    if (Ar.IsSaving())
+    {
+        TArray<const FSimpleMeshSection*> SavedSections;
+        TArray<int32> SavedIndices;
+
+        // Released and evicted sections are saved from what they kept, reserved so the saved pointers stay valid
+        TArray<FSimpleMeshSection> RebuiltSections;
+        RebuiltSections.Reserve(MeshSections.Num());
+        for (TSparseArray<FSimpleMeshSection>::TConstIterator It(MeshSections); It; ++It)
+        {
+            if (It->VertexBuffer.Num() > 0)
+            {
+                SavedSections.Add(&*It);
+                SavedIndices.Add(It.GetIndex());
+                continue;
+            }
+
+            if (!It->bGeometryReleased && It->CompressedVertices.Num() == 0)
+            {
+                continue;
+            }
+
+            FSimpleMeshSection& Rebuilt = RebuiltSections.AddDefaulted_GetRef();
+            Rebuilt.MaterialIndex = It->MaterialIndex;
+            Rebuilt.SectionLocalBox = It->SectionLocalBox;
+            Rebuilt.bEnableCollision = It->bEnableCollision;
+            Rebuilt.Visible = It->Visible;
+            Rebuilt.bGenerateNormals = It->bGenerateNormals;
+            if (!It->GetCPUGeometry(Rebuilt.VertexBuffer, Rebuilt.IndexBuffer))
+            {
+                UE_LOG(LogSimpleComponent, Warning, TEXT("%s: section %d released its geometry and is not saved, use KeepPositions to save it."), *GetPathName(), It.GetIndex());
+                RebuiltSections.Pop(false);
+                continue;
+            }
+
+            // Only positions survive a release, generated normals can be generated again
+            if (It->bGeometryReleased && Rebuilt.bGenerateNormals)
+            {
+                SimpleMeshNormals::ComputeSectionNormals(Rebuilt);
+            }
+            SavedSections.Add(&Rebuilt);
+            SavedIndices.Add(It.GetIndex());
+        }
+        SimpleMeshSerialization::WriteSections(SavedSections, SavedIndices, bQuantizeSerializedPositions, Blob);
+    }
+
+    SimpleMeshSerialization::SerializeBlob(Ar, Blob, bCompressSerializedSections);
+
+    if (Ar.IsLoading())
+    {
+        if (!SimpleMeshSerialization::ReadSections(Blob, MeshSections))
+        {
+            UE_LOG(LogSimpleComponent, Warning, TEXT("%s: could not restore serialized mesh sections."), *GetPathName());
+            MeshSections.Empty();
+        }
+    }
 }
 
 
 FPrimitiveSceneProxy* USimpleMeshComponent::CreateSceneProxy()
 {
-    //SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_CreateSceneProxy);
-    return new FSimpleSceneProxy(this);
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_CreateSceneProxy);
+
+    // The new proxy is built from the current section data, pending partial uploads are redundant
+    for (FSimpleMeshSection& Section : MeshSections)
+    {
+        FlushSectionNormals(Section);
+        Section.DirtyVertexRanges.Reset();
+    }
+
+    // The proxy copied what it needs, the retention policies apply from here
+    FSimpleSceneProxy* NewProxy = new FSimpleSceneProxy(this);
+    for (TSparseArray<FSimpleMeshSection>::TIterator It(MeshSections); It; ++It)
+    {
+        ReleaseSectionGeometry(*It, NewProxy->GetSceneSection(It.GetIndex()));
+    }
+    return NewProxy;
+}
+
+FSimpleSceneProxy::FSimpleSceneProxy(USimpleMeshComponent* Component) :
+    FSimpleMeshSceneProxy(Component)
+{
+    bShouldRenderStatic = !IsMovable();
+
+    // One entry per slot, free slots stay null
+    OccluderData = Component->GetOccluderData();
+    Sections.AddZeroed(Component->MeshSections.GetMaxIndex());
+
+    // Materials are resolved here, the workers only copy vertex data
+    struct FSectionToBuild
+    {
+        int32 SectionIndex;
+        FSimpleMeshSection* MeshSection;
+        UMaterialInterface* Material;
+    };
+    TArray<FSectionToBuild> SectionsToBuild;
+    SectionsToBuild.Reserve(Component->MeshSections.Num());
+    for (TSparseArray<FSimpleMeshSection>::TIterator It(Component->MeshSections); It; ++It)
+    {
+        UMaterialInterface* Material = Component->GetMaterial(It->MaterialIndex);
+        SectionsToBuild.Add({ It.GetIndex(), &*It, Material ? Material : UMaterial::GetDefaultMaterial(MD_Surface) });
+    }
+
+    const bool bParallel = GSimpleMeshProxyParallelSectionThreshold > 0 && SectionsToBuild.Num() >= GSimpleMeshProxyParallelSectionThreshold;
+    ParallelFor(SectionsToBuild.Num(), [&](int32 BuildIdx)
+    {
+        const FSectionToBuild& Build = SectionsToBuild[BuildIdx];
+        Sections[Build.SectionIndex] = CreateSceneSection(Component, *Build.MeshSection, Build.Material, true);
+    }, !bParallel);
+
+    // One render command for the whole proxy instead of one per section
+    TArray<FSimpleMeshSceneSection*> SectionsToInit;
+    SectionsToInit.Reserve(SectionsToBuild.Num());
+    for (FSimpleMeshSceneSection* Section : Sections)
+    {
+        if (Section)
+        {
+            SectionsToInit.Add(Section);
+        }
+    }
+    if (SectionsToInit.Num() > 0)
+    {
+        ENQUEUE_RENDER_COMMAND(InitSimpleMeshProxySections)([SectionsToInit = MoveTemp(SectionsToInit)](FRHICommandListImmediate& RHICmdList)
+        {
+            for (FSimpleMeshSceneSection* Section : SectionsToInit)
+            {
+                Section->InitResources_RenderThread(RHICmdList);
+                if (Section->ShadowSection)
+                {
+                    Section->ShadowSection->InitResources_RenderThread(RHICmdList);
+                }
+            }
+        });
+    }
+
+    SectionsUpdated();
 }
 
+#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
+
+/** Time the creation of scene proxies for growing section counts, serial versus parallel section preparation */
+static FAutoConsoleCommandWithWorldAndArgs GSimpleMeshProxyBenchmarkCmd(
+    TEXT("SimpleMesh.Proxy.Benchmark"),
+    TEXT("Time scene proxy creation for 1 to N sections (default 1000) of M x M vertices (default 33), serial versus parallel section preparation"),
+    FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+    {
+        if (!World || !World->Scene)
+        {
+            return;
+        }
+
+        const int32 MaxSections = Args.Num() > 0 ? FMath::Max(1, FCString::Atoi(*Args[0])) : 1000;
+        const int32 VerticesPerSide = Args.Num() > 1 ? FMath::Clamp(FCString::Atoi(*Args[1]), 2, 256) : 33;
+
+        TArray<FVector> Vertices;
+        TArray<int32> Triangles;
+        for (int32 Y = 0; Y < VerticesPerSide; Y++)
+        {
+            for (int32 X = 0; X < VerticesPerSide; X++)
+            {
+                Vertices.Emplace(X * 10.0, Y * 10.0, 0.0);
+                if (X < VerticesPerSide - 1 && Y < VerticesPerSide - 1)
+                {
+                    const int32 Index = Y * VerticesPerSide + X;
+                    Triangles.Append({ Index, Index + VerticesPerSide, Index + 1, Index + 1, Index + VerticesPerSide, Index + VerticesPerSide + 1 });
+                }
+            }
+        }
+
+        USimpleMeshComponent* Component = NewObject<USimpleMeshComponent>(World, NAME_None, RF_Transient);
+        Component->SetVisibility(false);
+        Component->RegisterComponentWithWorld(World);
+
+        const int32 SavedThreshold = GSimpleMeshProxyParallelSectionThreshold;
+        for (int32 NumSections = 1; ; NumSections = FMath::Min(NumSections * 10, MaxSections))
+        {
+            for (int32 SectionIdx = Component->MeshSections.Num(); SectionIdx < NumSections; SectionIdx++)
+            {
+                Component->CreateMeshSection(SectionIdx, Vertices, Triangles, nullptr);
+            }
+
+            // Game thread construction, then until the render thread has initialized every section
+            double Times[2][2];
+            for (int32 Mode = 0; Mode < 2; Mode++)
+            {
+                GSimpleMeshProxyParallelSectionThreshold = Mode == 0 ? 0 : 1;
+                FlushRenderingCommands();
+
+                const double Start = FPlatformTime::Seconds();
+                FSimpleSceneProxy* Proxy = new FSimpleSceneProxy(Component);
+                Times[Mode][0] = FPlatformTime::Seconds() - Start;
+                FlushRenderingCommands();
+                Times[Mode][1] = FPlatformTime::Seconds() - Start;
+
+                ENQUEUE_RENDER_COMMAND(DeleteSimpleMeshBenchmarkProxy)([Proxy](FRHICommandListImmediate&)
+                {
+                    delete Proxy;
+                });
+            }
+
+            UE_LOG(LogSimpleComponent, Display, TEXT("%5d sections: serial %8.2f ms (%8.2f ms with RHI init), parallel %8.2f ms (%8.2f ms with RHI init), x%.2f"),
+                NumSections, Times[0][0] * 1000.0, Times[0][1] * 1000.0, Times[1][0] * 1000.0, Times[1][1] * 1000.0, Times[0][0] / FMath::Max(Times[1][0], 1e-9));
+
+            if (NumSections >= MaxSections)
+            {
+                break;
+            }
+        }
+        GSimpleMeshProxyParallelSectionThreshold = SavedThreshold;
+
+        Component->DestroyComponent();
+    }));
+
+#endif
+
 static void ConvertSimpleMeshToDynMeshVertex(FDynamicMeshVertex& Vert, const FSimpleMeshVertex& SimpleVert)
 {
     Vert.Position = (FVector3f)SimpleVert.Position;
 }
 
 
+/** xxHash64 of the raw input, 0 is reserved for "unknown" */
+static uint64 HashSectionPositions(const TArray<FVector>& Vertices)
+{
+    const uint64 Hash = FXxHash64::HashBuffer(Vertices.GetData(), Vertices.Num() * sizeof(FVector)).Hash;
+    return Hash != 0 ? Hash : 1;
+}
+
+static uint64 HashSectionIndices(const TArray<int32>& Triangles)
+{
+    const uint64 Hash = FXxHash64::HashBuffer(Triangles.GetData(), Triangles.Num() * sizeof(int32)).Hash;
+    return Hash != 0 ? Hash : 1;
+}
+
 void USimpleMeshComponent::CreateMeshSection(int32 SectionIndex, const TArray<FVector>& Vertices, const TArray<int32>& Triangles, UMaterialInterface* Material, bool bSectionVisible, bool bCreateCollision)
 {
     // Vrifier que les tableaux de vertices et de triangles ne sont pas vides avant de continuer.
@@ -99,14 +422,38 @@ void USimpleMeshComponent::CreateMeshSection(int32 SectionIndex, const TArray<FV
         return; // Sortie anticipe pour viter un crash d  des donnes vides.
     }
 
-    // Ajuster la taille du tableau MeshSections pour s'assurer qu'il peut contenir la nouvelle section.
-    if (SectionIndex >= MeshSections.Num())
+    if (SectionIndex < 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("CreateMeshSection called with negative section index %d."), SectionIndex);
+        return;
+    }
+
+    const uint64 PositionsHash = HashSectionPositions(Vertices);
+    const uint64 IndicesHash = HashSectionIndices(Triangles);
+
+    // Occuper le slot demand, les slots intermdiaires restent libres (pas de sections vides).
+    if (!MeshSections.IsValidIndex(SectionIndex))
+    {
+        MeshSections.Insert(SectionIndex, FSimpleMeshSection());
+    }
+    else
     {
-        MeshSections.SetNum(SectionIndex + 1, true); // Utilisez true pour initialiser les nouvelles sections.
+        // The same section emitted again: nothing to convert, cook or upload
+        const FSimpleMeshSection& Existing = MeshSections[SectionIndex];
+        if (Existing.PositionsHash == PositionsHash && Existing.IndicesHash == IndicesHash
+            && Existing.MaterialIndex == Materials.IndexOfByKey(Material) && Existing.Visible == bSectionVisible
+            && Existing.bEnableCollision == bCreateCollision && Existing.bGenerateNormals == bGenerateNormals
+            && Existing.Retention == DefaultSectionRetention)
+        {
+            INC_DWORD_STAT(STAT_SimpleMesh_SkippedUpdates);
+            return;
+        }
     }
 
     FSimpleMeshSection& Section = MeshSections[SectionIndex];
     Section.Reset(); // Rinitialiser la section pour nettoyer les donnes prcdentes.
+    Section.PositionsHash = PositionsHash;
+    Section.IndicesHash = IndicesHash;
 
    // Section.MaterialIndex = GetMaterials().IndexOfByKey(Material);
     if (Section.MaterialIndex == INDEX_NONE)
@@ -119,6 +466,9 @@ void USimpleMeshComponent::CreateMeshSection(int32 SectionIndex, const TArray<FV
    
     Section.Visible = bSectionVisible;
 
+    Section.VertexBuffer.Reserve(Vertices.Num());
+    Section.IndexBuffer.Reserve(Triangles.Num());
+
     // Conversion de FVector  FVector3f et ajout au VertexBuffer
     for (const FVector& Vertex : Vertices)
     {
@@ -126,6 +476,7 @@ void USimpleMeshComponent::CreateMeshSection(int32 SectionIndex, const TArray<FV
         FDynamicMeshVertex DynamicVertex;
         DynamicVertex.Position = Vertex3f;
         Section.VertexBuffer.Add(DynamicVertex);
+        Section.SectionLocalBox += Vertex;
     }
 
     // Conversion de int32  uint32 pour les indices des triangles
@@ -134,15 +485,113 @@ void USimpleMeshComponent::CreateMeshSection(int32 SectionIndex, const TArray<FV
         Section.IndexBuffer.Add(static_cast<uint32>(Index));
     }
 
+    WeldIngestedSection(Section);
+
     // Activer la collision pour cette section, si demand
     Section.bEnableCollision = bCreateCollision;
+    Section.Retention = DefaultSectionRetention;
+
+    Section.bGenerateNormals = bGenerateNormals;
+    if (Section.bGenerateNormals)
+    {
+        SimpleMeshNormals::ComputeSectionNormals(Section);
+    }
 
 
+    RequestSectionShadowMesh(SectionIndex);
+    RequestSectionCollisionMesh(SectionIndex);
 
-    // Mise  jour des limites locales, de la collision et du marquage pour la recration de l'tat de rendu
+    // Mise  jour des limites locales, de la collision et du slot de rendu de cette section seulement
     UpdateLocalBounds();
     UpdateCollision();
-    MarkRenderStateDirty();
+    UpdateSectionProxy(SectionIndex);
+}
+
+FSimpleMeshSectionHandle USimpleMeshComponent::AddMeshSection(const TArray<FVector>& Vertices, const TArray<int32>& Triangles, UMaterialInterface* Material, bool bSectionVisible, bool bCreateCollision)
+{
+    if (Vertices.IsEmpty() || Triangles.IsEmpty())
+    {
+        UE_LOG(LogTemp, Warning, TEXT("AddMeshSection called with empty vertices or triangles array. Skipping section creation."));
+        return FSimpleMeshSectionHandle();
+    }
+
+    // Reuses the most recently freed slot, if any
+    const int32 SectionIndex = MeshSections.Add(FSimpleMeshSection());
+    CreateMeshSection(SectionIndex, Vertices, Triangles, Material, bSectionVisible, bCreateCollision);
+    return GetSectionHandle(SectionIndex);
+}
+
+bool USimpleMeshComponent::RemoveMeshSectionByHandle(FSimpleMeshSectionHandle Handle)
+{
+    if (!IsSectionHandleValid(Handle))
+    {
+        return false;
+    }
+
+    RemoveMeshSection(Handle.Index);
+    return true;
+}
+
+FSimpleMeshSectionHandle USimpleMeshComponent::GetSectionHandle(int32 SectionIndex) const
+{
+    if (!MeshSections.IsValidIndex(SectionIndex))
+    {
+        return FSimpleMeshSectionHandle();
+    }
+
+    return FSimpleMeshSectionHandle(SectionIndex, SectionGenerations.IsValidIndex(SectionIndex) ? SectionGenerations[SectionIndex] : 0);
+}
+
+int32 USimpleMeshComponent::GetSectionIndex(FSimpleMeshSectionHandle Handle) const
+{
+    return IsSectionHandleValid(Handle) ? Handle.Index : INDEX_NONE;
+}
+
+bool USimpleMeshComponent::IsSectionHandleValid(FSimpleMeshSectionHandle Handle) const
+{
+    return MeshSections.IsValidIndex(Handle.Index) && GetSectionHandle(Handle.Index) == Handle;
+}
+
+void USimpleMeshComponent::BumpSectionGeneration(int32 SectionIndex)
+{
+    if (SectionIndex >= SectionGenerations.Num())
+    {
+        SectionGenerations.SetNumZeroed(SectionIndex + 1);
+    }
+    SectionGenerations[SectionIndex]++;
+}
+
+void USimpleMeshComponent::UpdateSectionProxy(int32 SectionIndex)
+{
+    // Every change of a whole section comes through here
+    MarkSectionSnapshotStale(SectionIndex);
+
+    // A proxy about to be recreated picks the change up anyway
+    if (SceneProxy == nullptr || IsRenderStateDirty())
+    {
+        MarkRenderStateDirty();
+        return;
+    }
+
+    FSimpleSceneProxy* SimpleProxy = static_cast<FSimpleSceneProxy*>(SceneProxy);
+    FSimpleMeshSceneSection* NewSection = nullptr;
+    if (MeshSections.IsValidIndex(SectionIndex))
+    {
+        // The new render data is built from the current vertices, pending partial uploads are redundant
+        FSimpleMeshSection& Section = MeshSections[SectionIndex];
+        FlushSectionNormals(Section);
+        Section.DirtyVertexRanges.Reset();
+        NewSection = SimpleProxy->CreateSceneSection(this, Section);
+
+        // Only this section was built, its retention policy applies now
+        ReleaseSectionGeometry(Section, NewSection);
+    }
+
+    ENQUEUE_RENDER_COMMAND(FSimpleMeshSetSection)(
+        [SimpleProxy, SectionIndex, NewSection](FRHICommandListImmediate& RHICmdList)
+        {
+            SimpleProxy->SetSection_RenderThread(SectionIndex, NewSection);
+        });
 }
 
 
@@ -154,7 +603,40 @@ void USimpleMeshComponent::UpdateMeshSection(int32 SectionIndex, const TArray<FV
     {
 
         FSimpleMeshSection& Section = MeshSections[SectionIndex];
+
+        // Generators often emit the same chunk again, compare with what the section was built from
+        const uint64 PositionsHash = HashSectionPositions(Vertices);
+        const uint64 IndicesHash = HashSectionIndices(Triangles);
+        const bool bSameTopology = Section.IndicesHash == IndicesHash;
+        if (bSameTopology && Section.PositionsHash == PositionsHash)
+        {
+            INC_DWORD_STAT(STAT_SimpleMesh_SkippedUpdates);
+            return;
+        }
+
+        // Same triangles, moved vertices: patch the positions like a deform instead of rebuilding the section.
+        // Welding could merge differently, released sections have nothing to patch.
+        if (bSameTopology && !bWeldVertices && Section.VertexBuffer.Num() > 0 && Section.VertexBuffer.Num() == Vertices.Num())
+        {
+            FBox3f SectionBox(ForceInit);
+            for (int32 VertIdx = 0; VertIdx < Vertices.Num(); VertIdx++)
+            {
+                const FVector3f Position(Vertices[VertIdx]);
+                Section.VertexBuffer[VertIdx].Position = Position;
+                SectionBox += Position;
+            }
+
+            FinishSectionDeform(SectionIndex, SectionBox, true);
+            Section.PositionsHash = PositionsHash;
+            RequestSectionShadowMesh(SectionIndex);
+            INC_DWORD_STAT(STAT_SimpleMesh_PositionOnlyUpdates);
+            return;
+        }
+
+        Section.PositionsHash = PositionsHash;
+        Section.IndicesHash = IndicesHash;
         Section.VertexBuffer.Empty(Vertices.Num());
+        Section.SectionLocalBox.Init();
 
         // Conversion de FVector  FVector3f et ajout au VertexBuffer
         for (const FVector& Vertex : Vertices)
@@ -163,15 +645,34 @@ void USimpleMeshComponent::UpdateMeshSection(int32 SectionIndex, const TArray<FV
             FDynamicMeshVertex DynamicVertex;
             DynamicVertex.Position = Vertex3f;
             Section.VertexBuffer.Add(DynamicVertex);
+            Section.SectionLocalBox += Vertex;
         }
 
         // Conversion de int32  uint32 pour les indices des triangles
+        Section.ClearReleasedGeometry();
         Section.IndexBuffer.Empty(Triangles.Num());
         for (const int32& Index : Triangles)
         {
             Section.IndexBuffer.Add(static_cast<uint32>(Index));
         }
 
+        WeldIngestedSection(Section);
+
+        // Topology may have changed, the adjacency and the BVH are rebuilt on demand
+        Section.NormalAdjacency.Reset();
+        Section.BVH.Reset();
+        Section.bBVHNeedsRefit = false;
+        if (Section.bGenerateNormals)
+        {
+            SimpleMeshNormals::ComputeSectionNormals(Section);
+        }
+
+        // The old shadow and collision meshes no longer match
+        Section.ClearShadowMesh();
+        Section.ClearCollisionMesh();
+        RequestSectionShadowMesh(SectionIndex);
+        RequestSectionCollisionMesh(SectionIndex);
+
         // If we have collision enabled on this section, update that too
         if (Section.bEnableCollision)
         {
@@ -196,7 +697,7 @@ void USimpleMeshComponent::UpdateMeshSection(int32 SectionIndex, const TArray<FV
 
         UpdateLocalBounds();
         UpdateCollision(); //Good for Update Collision
-        MarkRenderStateDirty();
+        UpdateSectionProxy(SectionIndex);
     }
 }
 
@@ -204,320 +705,2011 @@ void USimpleMeshComponent::RemoveMeshSection(int32 SectionIndex)
 {
     if (MeshSections.IsValidIndex(SectionIndex))
     {
+        // O(1), the slot is freed and the other sections keep their index
         MeshSections.RemoveAt(SectionIndex);
+        BumpSectionGeneration(SectionIndex);
         UpdateLocalBounds();
         UpdateCollision();
-        MarkRenderStateDirty();
+        UpdateSectionProxy(SectionIndex);
     }
 }
 
 void USimpleMeshComponent::ClearAllMeshSections()
 {
+    for (TSparseArray<FSimpleMeshSection>::TConstIterator It(MeshSections); It; ++It)
+    {
+        BumpSectionGeneration(It.GetIndex());
+    }
     MeshSections.Empty();
+    bAllSnapshotsStale = true;
+    MarkSectionSnapshotStale(INDEX_NONE);
     UpdateLocalBounds();
     UpdateCollision();
     MarkRenderStateDirty();
 }
 
 
-bool USimpleMeshComponent::GetTriMeshSizeEstimates(struct FTriMeshCollisionDataEstimates& OutTriMeshEstimates, bool bInUseAllTriData) const
+void USimpleMeshComponent::MeshVoxelGrid(const FSimpleMeshVoxelGrid& Grid, ESimpleMeshVoxelMode Mode, bool bCreateCollision)
 {
-    for (const FSimpleMeshSection& Section : MeshSections)
-    {
-        if (Section.bEnableCollision)
-        {
-            OutTriMeshEstimates.VerticeCount += Section.VertexBuffer.Num();
-        }
-    }
+    // Cancels a pending async request, this result is newer
+    ++VoxelMeshSerial;
 
-    return true;
+    TArray<FSimpleMeshSection> NewSections;
+    SimpleMeshVoxel::MeshGrid(Grid, Mode, NewSections);
+    ReplaceMeshSections(MoveTemp(NewSections), bCreateCollision);
 }
 
-FBoxSphereBounds USimpleMeshComponent::CalcBounds(const FTransform& LocalToWorld) const
+void USimpleMeshComponent::MeshVoxelGridAsync(const FSimpleMeshVoxelGrid& Grid, ESimpleMeshVoxelMode Mode, bool bCreateCollision)
 {
-    FBox BoundingBox(ForceInit);
+    const uint32 Serial = ++VoxelMeshSerial;
 
-    for (const FSimpleMeshSection& Section : MeshSections)
+    Async(EAsyncExecution::ThreadPool, [WeakThis = TWeakObjectPtr<USimpleMeshComponent>(this), Serial, Grid, Mode, bCreateCollision]()
     {
-        for (const FDynamicMeshVertex& Vertex : Section.VertexBuffer)
-        {
-            // Convertir explicitement FVector3f en FVector avant de l'ajouter  BoundingBox
-            FVector VertexPosition = FVector(Vertex.Position.X, Vertex.Position.Y, Vertex.Position.Z);
-            BoundingBox += VertexPosition;
-        }
-    }
-
-    return FBoxSphereBounds(BoundingBox).TransformBy(LocalToWorld);
-}
+        TArray<FSimpleMeshSection> NewSections;
+        SimpleMeshVoxel::MeshGrid(Grid, Mode, NewSections);
 
-void USimpleMeshComponent::UpdateLocalBounds()
-{
-    FBox LocalBox(ForceInit);
-    for (const FSimpleMeshSection& Section : MeshSections)
-    {
-        for (const FDynamicMeshVertex& Vertex : Section.VertexBuffer)
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, bCreateCollision, NewSections = MoveTemp(NewSections)]() mutable
         {
-            // Convertir explicitement FVector3f en FVector avant de l'ajouter  LocalBox
-            FVector VertexPosition = FVector(Vertex.Position.X, Vertex.Position.Y, Vertex.Position.Z);
-            LocalBox += VertexPosition;
-        }
-    }
-    LocalBounds = FBoxSphereBounds(LocalBox);
-    UpdateBounds();
-}
-
-bool USimpleMeshComponent::DoesSectionExist(int32 SectionIndex) const
-{
-    return MeshSections.IsValidIndex(SectionIndex) ;
+            USimpleMeshComponent* Component = WeakThis.Get();
+            if (Component && Serial == Component->VoxelMeshSerial)
+            {
+                Component->ReplaceMeshSections(MoveTemp(NewSections), bCreateCollision);
+            }
+        });
+    });
 }
 
-int32 USimpleMeshComponent::GetNumSections() const
+USimpleMeshBuilder* USimpleMeshComponent::CreateMeshBuilder()
 {
-    return MeshSections.Num();
+    return NewObject<USimpleMeshBuilder>(this, NAME_None, RF_Transient);
 }
 
-void USimpleMeshComponent::AddCollisionConvexMesh(TArray<FVector> ConvexVerts)
+void USimpleMeshComponent::CommitMeshSection(int32 SectionIndex, FSimpleMeshSection&& NewSection, UMaterialInterface* Material, bool bSectionVisible, bool bCreateCollision)
 {
-    if (ConvexVerts.Num() >= 4)
+    if (NewSection.VertexBuffer.IsEmpty() || NewSection.IndexBuffer.Num() < 3)
     {
-        // New element
-        FKConvexElem NewConvexElem;
-        // Copy in vertex info
-        NewConvexElem.VertexData = ConvexVerts;
-        // Update bounding box
-        NewConvexElem.ElemBox = FBox(ConvexVerts);
-        // Add to array of convex elements
-        CollisionConvexElems.Add(NewConvexElem);
-        // Refresh collision
-        UpdateCollision();
+        UE_LOG(LogTemp, Warning, TEXT("CommitMeshSection called with an empty section. Skipping section creation."));
+        return;
     }
-}
 
-
-
-void USimpleMeshComponent::UpdateCollision()
-{
-   // SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_UpdateCollision);
-    
-    UWorld* World = GetWorld();
-    const bool bUseAsyncCook = World && World->IsGameWorld() && bUseAsyncCooking;
-    if (bUseAsyncCook)
+    if (SectionIndex < 0)
     {
-        
-        // Abort all previous ones still standing
-        for (UBodySetup* OldBody : AsyncBodySetupQueue)
-        {
-            OldBody->AbortPhysicsMeshAsyncCreation();
-        }
+        UE_LOG(LogTemp, Warning, TEXT("CommitMeshSection called with negative section index %d."), SectionIndex);
+        return;
+    }
 
-        AsyncBodySetupQueue.Add(CreateBodySetupHelper());
+    if (!MeshSections.IsValidIndex(SectionIndex))
+    {
+        MeshSections.Insert(SectionIndex, MoveTemp(NewSection));
     }
     else
     {
-        AsyncBodySetupQueue.Empty();	//If for some reason we modified the async at runtime, just clear any pending async body setups
-        CreateSimpleMeshBodySetup(); 
-        
+        MeshSections[SectionIndex] = MoveTemp(NewSection);
     }
 
-    UBodySetup* UseBodySetup = bUseAsyncCook ? AsyncBodySetupQueue.Last() : SimpleMeshBodySetup;
-
-    // Fill in simple collision convex elements
-    UseBodySetup->AggGeom.ConvexElems = CollisionConvexElems;
+    // Only the geometry comes from outside, the state derived from it starts over
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    Section.DirtyVertexRanges.Reset();
+    Section.NormalAdjacency.Reset();
+    Section.BVH.Reset();
+    Section.bBVHNeedsRefit = false;
+    Section.PositionsHash = 0;
+    Section.IndicesHash = 0;
+    Section.ClearReleasedGeometry();
+
+    Section.MaterialIndex = Materials.AddUnique(Material);
+    Section.Visible = bSectionVisible;
 
-    // Set trace flag
-    UseBodySetup->CollisionTraceFlag = bUseComplexAsSimpleCollision ? CTF_UseComplexAsSimple : CTF_UseDefault;
+    WeldIngestedSection(Section);
 
-    if (bUseAsyncCook)
+    Section.bEnableCollision = bCreateCollision;
+    Section.Retention = DefaultSectionRetention;
+    Section.bGenerateNormals |= bGenerateNormals;
+    if (Section.bGenerateNormals)
     {
-        
-        UseBodySetup->CreatePhysicsMeshesAsync(FOnAsyncPhysicsCookFinished::CreateUObject(this, &USimpleMeshComponent::FinishPhysicsAsyncCook, UseBodySetup));
+        SimpleMeshNormals::ComputeSectionNormals(Section);
+    }
+
+    // Native builders may provide their own shadow mesh
+    Section.ShadowMeshSerial = 0;
+    if (Section.ShadowVertexBuffer.Num() == 0)
+    {
+        RequestSectionShadowMesh(SectionIndex);
+    }
+
+    // And their own collision mesh
+    Section.CollisionMeshSerial = 0;
+    Section.bCustomCollisionMesh = Section.HasCollisionMesh();
+    if (!Section.HasCollisionMesh())
+    {
+        RequestSectionCollisionMesh(SectionIndex);
+    }
+
+    UpdateLocalBounds();
+    UpdateCollision();
+    UpdateSectionProxy(SectionIndex);
+}
+
+void USimpleMeshComponent::ReplaceMeshSections(TArray<FSimpleMeshSection>&& NewSections, bool bCreateCollision)
+{
+    for (TSparseArray<FSimpleMeshSection>::TConstIterator It(MeshSections); It; ++It)
+    {
+        BumpSectionGeneration(It.GetIndex());
+    }
+    MeshSections.Empty(NewSections.Num());
+
+    for (int32 SectionIndex = 0; SectionIndex < NewSections.Num(); SectionIndex++)
+    {
+        FSimpleMeshSection& Section = NewSections[SectionIndex];
+        if (Section.IndexBuffer.Num() < 3 || Section.VertexBuffer.Num() == 0)
+        {
+            continue;
+        }
+
+        Section.bEnableCollision = bCreateCollision;
+        Section.Retention = DefaultSectionRetention;
+        if (Section.bGenerateNormals)
+        {
+            SimpleMeshNormals::ComputeSectionNormals(Section);
+        }
+        MeshSections.Insert(SectionIndex, MoveTemp(Section));
+    }
+    NewSections.Reset();
+
+    for (TSparseArray<FSimpleMeshSection>::TConstIterator It(MeshSections); It; ++It)
+    {
+        RequestSectionShadowMesh(It.GetIndex());
+        RequestSectionCollisionMesh(It.GetIndex());
+    }
+
+    bAllSnapshotsStale = true;
+    MarkSectionSnapshotStale(INDEX_NONE);
+    UpdateLocalBounds();
+    UpdateCollision();
+    MarkRenderStateDirty();
+}
+
+bool USimpleMeshComponent::GetTriMeshSizeEstimates(struct FTriMeshCollisionDataEstimates& OutTriMeshEstimates, bool bInUseAllTriData) const
+{
+    for (const FSimpleMeshSection& Section : MeshSections)
+    {
+        if (Section.bEnableCollision)
+        {
+            OutTriMeshEstimates.VerticeCount += Section.HasCollisionMesh() ? Section.CollisionVertices.Num() : Section.GetNumVertices();
+        }
+    }
+
+    return true;
+}
+
+FBoxSphereBounds USimpleMeshComponent::CalcBounds(const FTransform& LocalToWorld) const
+{
+    // LocalBounds is kept up to date by UpdateLocalBounds, no need to walk the vertices again
+    return LocalBounds.TransformBy(LocalToWorld);
+}
+
+void USimpleMeshComponent::UpdateLocalBounds(bool bPositionsOnly)
+{
+    // Each section maintains its own box, so the overall bounds are just their union
+    FBox LocalBox(ForceInit);
+    for (const FSimpleMeshSection& Section : MeshSections)
+    {
+        if (Section.SectionLocalBox.IsValid)
+        {
+            LocalBox += Section.SectionLocalBox;
+        }
+    }
+    LocalBounds = LocalBox.IsValid ? FBoxSphereBounds(LocalBox) : FBoxSphereBounds(ForceInit);
+    UpdateBounds();
+    MarkRenderTransformDirty();
+
+    // Every geometry change goes through here, deforms are throttled
+    if (bPositionsOnly)
+    {
+        DeferOccluderUpdate();
+    }
+    else
+    {
+        RequestOccluderUpdate();
+    }
+}
+
+FSimpleMeshSnapshotPtr USimpleMeshComponent::GetSnapshot() const
+{
+    FRWScopeLock Lock(SnapshotLock, SLT_ReadOnly);
+    return PublishedSnapshot;
+}
+
+FSimpleMeshSectionSnapshotPtr USimpleMeshComponent::GetSectionSnapshot(int32 SectionIndex) const
+{
+    const FSimpleMeshSnapshotPtr Snapshot = GetSnapshot();
+    return Snapshot.IsValid() && Snapshot->Sections.IsValidIndex(SectionIndex) ? Snapshot->Sections[SectionIndex] : nullptr;
+}
+
+void USimpleMeshComponent::MarkSectionSnapshotStale(int32 SectionIndex)
+{
+    // The occluder builds from the snapshots too
+    if (!bPublishSectionSnapshots && !bUseAsOccluder)
+    {
+        bAllSnapshotsStale = true;
+        return;
+    }
+
+    if (SectionIndex >= 0)
+    {
+        if (SectionIndex >= StaleSnapshots.Num())
+        {
+            StaleSnapshots.Add(false, SectionIndex + 1 - StaleSnapshots.Num());
+        }
+        StaleSnapshots[SectionIndex] = true;
+    }
+
+    // Many edits in a frame make a single publication
+    if (bPublishSectionSnapshots && !bSnapshotPublishPending)
+    {
+        bSnapshotPublishPending = true;
+        FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float)
+        {
+            if (bSnapshotPublishPending)
+            {
+                PublishSectionSnapshots();
+            }
+            return false;
+        }));
+    }
+}
+
+void USimpleMeshComponent::PublishSectionSnapshots()
+{
+    check(IsInGameThread());
+
+    const FSimpleMeshSnapshotPtr Previous = GetSnapshot();
+    TSharedRef<FSimpleMeshSnapshot, ESPMode::ThreadSafe> Next = MakeShared<FSimpleMeshSnapshot, ESPMode::ThreadSafe>();
+    Next->Version = ++SnapshotVersion;
+    Next->ComponentToWorld = GetComponentTransform();
+    Next->Sections.SetNum(MeshSections.GetMaxIndex());
+
+    // Unchanged sections share their copy with the previous snapshot
+    for (TSparseArray<FSimpleMeshSection>::TConstIterator It(MeshSections); It; ++It)
+    {
+        const int32 SectionIndex = It.GetIndex();
+        const bool bStale = bAllSnapshotsStale || !Previous.IsValid() || !Previous->Sections.IsValidIndex(SectionIndex) || !Previous->Sections[SectionIndex].IsValid()
+            || (StaleSnapshots.IsValidIndex(SectionIndex) && StaleSnapshots[SectionIndex]);
+        Next->Sections[SectionIndex] = bStale ? SimpleMeshSnapshot::MakeSectionSnapshot(*It, SectionIndex, Next->Version) : Previous->Sections[SectionIndex];
+    }
+
+    StaleSnapshots.Reset();
+    bAllSnapshotsStale = false;
+    bSnapshotPublishPending = false;
+
+    FRWScopeLock Lock(SnapshotLock, SLT_Write);
+    PublishedSnapshot = Next;
+}
+
+void USimpleMeshComponent::SetSectionRetention(int32 SectionIndex, ESimpleMeshSectionRetention InRetention)
+{
+    if (MeshSections.IsValidIndex(SectionIndex))
+    {
+        MeshSections[SectionIndex].Retention = InRetention;
+    }
+}
+
+void USimpleMeshComponent::GetSectionsMemory(int64& OutAllocatedBytes, int64& OutReleasedBytes) const
+{
+    OutAllocatedBytes = 0;
+    OutReleasedBytes = 0;
+    for (const FSimpleMeshSection& Section : MeshSections)
+    {
+        OutAllocatedBytes += Section.GetAllocatedSize();
+        OutReleasedBytes += Section.ReleasedBytes;
+    }
+}
+
+int64 FSimpleMeshSection::ReleaseGeometry(const FSimpleMeshSceneSection* RenderSection, bool bKeepOccluderGeometry)
+{
+    // Evicted sections free their render data, they need their CPU geometry to come back
+    if (Retention == ESimpleMeshSectionRetention::KeepAll || RenderSection == nullptr || bEvicted)
+    {
+        return 0;
+    }
+
+    // What later proxies draw instead of the CPU geometry
+    RenderBuffers = RenderSection->Buffers;
+    ShadowRenderBuffers.Reset();
+    if (RenderSection->ShadowSection)
+    {
+        ShadowRenderBuffers = RenderSection->ShadowSection->Buffers;
+    }
+    if (bGeometryReleased || VertexBuffer.Num() == 0)
+    {
+        // A shadow mesh finished after the release
+        ShadowVertexBuffer.Empty();
+        ShadowIndexBuffer.Empty();
+        return 0;
+    }
+
+    const int64 SizeBefore = GetAllocatedSize();
+
+    // Collision may be cooked again when another section changes, it needs positions and indices
+    if (Retention == ESimpleMeshSectionRetention::KeepPositions || bEnableCollision)
+    {
+        RetainedPositions.SetNumUninitialized(VertexBuffer.Num());
+        for (int32 VertIdx = 0; VertIdx < VertexBuffer.Num(); VertIdx++)
+        {
+            RetainedPositions[VertIdx] = VertexBuffer[VertIdx].Position;
+        }
+    }
+    else
+    {
+        // Positions and indices only, far less than the vertices
+        if (bKeepOccluderGeometry)
+        {
+            ReleasedSnapshot = SimpleMeshSnapshot::MakeSectionSnapshot(*this, INDEX_NONE, 0);
+        }
+        IndexBuffer.Empty();
+    }
+
+    VertexBuffer.Empty();
+    ShadowVertexBuffer.Empty();
+    ShadowIndexBuffer.Empty();
+    DirtyVertexRanges.Empty();
+    NormalAdjacency.Reset();
+    BVH.Reset();
+    bBVHNeedsRefit = false;
+    bGeometryReleased = true;
+
+    ReleasedBytes = SizeBefore - (int64)GetAllocatedSize();
+    INC_MEMORY_STAT_BY(STAT_SimpleMesh_ReleasedGeometry, ReleasedBytes);
+    return ReleasedBytes;
+}
+
+void USimpleMeshComponent::ReleaseSectionGeometry(FSimpleMeshSection& Section, const FSimpleMeshSceneSection* RenderSection)
+{
+    // Levels are saved from editor worlds, a release there would leave only positions to save
+    const UWorld* World = GetWorld();
+    if (bSerializeMeshSections && !(World && World->IsGameWorld()))
+    {
+        return;
+    }
+
+    Section.ReleaseGeometry(RenderSection, bUseAsOccluder && Section.bUseAsOccluder);
+}
+
+bool FSimpleMeshSection::GetCPUGeometry(TArray<FDynamicMeshVertex>& OutVertices, TArray<uint32>& OutIndices) const
+{
+    OutVertices.Reset();
+    OutIndices.Reset();
+
+    if (VertexBuffer.Num() > 0)
+    {
+        OutVertices = VertexBuffer;
+        OutIndices = IndexBuffer;
+        return true;
+    }
+
+    if (CompressedVertices.Num() > 0)
+    {
+        OutVertices.SetNumUninitialized(NumCompressedVertices);
+        OutIndices.SetNumUninitialized(NumCompressedIndices);
+        return FCompression::UncompressMemory(NAME_Oodle, OutVertices.GetData(), NumCompressedVertices * sizeof(FDynamicMeshVertex), CompressedVertices.GetData(), CompressedVertices.Num())
+            && FCompression::UncompressMemory(NAME_Oodle, OutIndices.GetData(), NumCompressedIndices * sizeof(uint32), CompressedIndices.GetData(), CompressedIndices.Num());
+    }
+
+    // KeepPositions and sections with collision keep their indices, the occluder snapshot has its own
+    const TArray<FVector3f>* Positions = &RetainedPositions;
+    const TArray<uint32>* Indices = &IndexBuffer;
+    if (RetainedPositions.Num() == 0 && ReleasedSnapshot.IsValid())
+    {
+        Positions = &ReleasedSnapshot->Positions;
+        Indices = &ReleasedSnapshot->Indices;
+    }
+    if (Positions->Num() == 0)
+    {
+        return false;
+    }
+
+    OutVertices.Reserve(Positions->Num());
+    for (const FVector3f& Position : *Positions)
+    {
+        OutVertices.Emplace(Position);
+    }
+    OutIndices = *Indices;
+    return true;
+}
+
+SIZE_T FSimpleMeshSection::GetAllocatedSize() const
+{
+    return VertexBuffer.GetAllocatedSize() + IndexBuffer.GetAllocatedSize() + RetainedPositions.GetAllocatedSize()
+        + DirtyVertexRanges.GetAllocatedSize() + NormalAdjacency.Offsets.GetAllocatedSize() + NormalAdjacency.Triangles.GetAllocatedSize()
+        + NormalAdjacency.FaceNormals.GetAllocatedSize() + (BVH.IsValid() ? BVH->GetAllocatedSize() : 0)
+        + CompressedVertices.GetAllocatedSize() + CompressedIndices.GetAllocatedSize()
+        + ShadowVertexBuffer.GetAllocatedSize() + ShadowIndexBuffer.GetAllocatedSize()
+        + CollisionVertices.GetAllocatedSize() + CollisionIndices.GetAllocatedSize()
+        + (ReleasedSnapshot.IsValid() ? ReleasedSnapshot->Positions.GetAllocatedSize() + ReleasedSnapshot->Indices.GetAllocatedSize() : 0);
+}
+
+void USimpleMeshComponent::SetSectionVisible(int32 SectionIndex, bool bNewVisibility)
+{
+    if (!MeshSections.IsValidIndex(SectionIndex) || MeshSections[SectionIndex].Visible == bNewVisibility)
+    {
+        return;
+    }
+
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    Section.Visible = bNewVisibility;
+    Section.HiddenTime = bNewVisibility ? 0.0 : FPlatformTime::Seconds();
+    MarkSectionSnapshotStale(SectionIndex);
+    RequestOccluderUpdate();
+
+    if (Section.bEvicted)
+    {
+        if (bNewVisibility)
+        {
+            RestoreEvictedSection(SectionIndex);
+        }
+        return;
+    }
+
+    // Only the options of the section change, a proxy about to be recreated picks the flag up anyway
+    if (SceneProxy && !IsRenderStateDirty())
+    {
+        FSimpleSceneProxy* SimpleProxy = static_cast<FSimpleSceneProxy*>(SceneProxy);
+        ENQUEUE_RENDER_COMMAND(FSimpleMeshSetSectionVisibility)(
+            [SimpleProxy, SectionIndex, bNewVisibility](FRHICommandListImmediate& RHICmdList)
+            {
+                SimpleProxy->SetSectionVisibility_RenderThread(SectionIndex, bNewVisibility);
+            });
+    }
+
+    UWorld* World = GetWorld();
+    if (!bNewVisibility && bReleaseHiddenSections && World && World->IsGameWorld())
+    {
+        FTSTicker::GetCoreTicker().AddTicker(TEXT("SimpleMeshEvictHiddenSection"), HiddenSectionReleaseDelay,
+            [WeakThis = TWeakObjectPtr<USimpleMeshComponent>(this), SectionIndex, HiddenTime = Section.HiddenTime](float DeltaTime)
+            {
+                if (USimpleMeshComponent* Component = WeakThis.Get())
+                {
+                    Component->EvictHiddenSection(SectionIndex, HiddenTime);
+                }
+                return false;
+            });
+    }
+}
+
+bool USimpleMeshComponent::IsSectionVisible(int32 SectionIndex) const
+{
+    return MeshSections.IsValidIndex(SectionIndex) && MeshSections[SectionIndex].Visible;
+}
+
+bool USimpleMeshComponent::IsSectionResident(int32 SectionIndex) const
+{
+    return MeshSections.IsValidIndex(SectionIndex) && !MeshSections[SectionIndex].bEvicted;
+}
+
+static void CompressSectionBuffer(const void* Data, int32 NumBytes, TArray<uint8>& OutCompressed)
+{
+    int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, NumBytes);
+    OutCompressed.SetNumUninitialized(CompressedSize);
+    verify(FCompression::CompressMemory(NAME_Oodle, OutCompressed.GetData(), CompressedSize, Data, NumBytes));
+    OutCompressed.SetNum(CompressedSize, false);
+    OutCompressed.Shrink();
+}
+
+void USimpleMeshComponent::EvictHiddenSection(int32 SectionIndex, double HiddenTime)
+{
+    // Shown since, or hidden again later: that hide has its own timer
+    if (!MeshSections.IsValidIndex(SectionIndex) || MeshSections[SectionIndex].Visible || MeshSections[SectionIndex].HiddenTime != HiddenTime)
+    {
+        return;
+    }
+
+    // Without its CPU geometry the section could never come back
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    if (Section.bEvicted || Section.bGeometryReleased || Section.VertexBuffer.Num() == 0)
+    {
+        return;
+    }
+
+    Section.bEvicted = true;
+    INC_DWORD_STAT(STAT_SimpleMesh_SectionEvictions);
+
+    // Collision is cooked from the positions of every section, sections with collision keep them as they are
+    if (bCompressHiddenSections && !Section.bEnableCollision)
+    {
+        FlushSectionNormals(Section);
+        Section.NumCompressedVertices = Section.VertexBuffer.Num();
+        Section.NumCompressedIndices = Section.IndexBuffer.Num();
+        CompressSectionBuffer(Section.VertexBuffer.GetData(), Section.VertexBuffer.Num() * sizeof(FDynamicMeshVertex), Section.CompressedVertices);
+        CompressSectionBuffer(Section.IndexBuffer.GetData(), Section.IndexBuffer.Num() * sizeof(uint32), Section.CompressedIndices);
+
+        Section.VertexBuffer.Empty();
+        Section.IndexBuffer.Empty();
+        Section.DirtyVertexRanges.Empty();
+        Section.NormalAdjacency.Reset();
+        Section.BVH.Reset();
+        Section.bBVHNeedsRefit = false;
+    }
+
+    // Evicted sections have no render data: this frees the buffers of the slot
+    UpdateSectionProxy(SectionIndex);
+}
+
+void USimpleMeshComponent::RestoreEvictedSection(int32 SectionIndex)
+{
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    if (Section.CompressedVertices.Num() == 0)
+    {
+        Section.bEvicted = false;
+        INC_DWORD_STAT(STAT_SimpleMesh_SectionRestores);
+        UpdateSectionProxy(SectionIndex);
+        return;
+    }
+
+    // Already on its way back
+    if (Section.RestoreSerial != 0)
+    {
+        return;
+    }
+
+    Section.RestoreSerial = ++SectionRestoreSerial;
+    Async(EAsyncExecution::ThreadPool, [WeakThis = TWeakObjectPtr<USimpleMeshComponent>(this), SectionIndex, Serial = Section.RestoreSerial,
+        CompressedVertices = Section.CompressedVertices, CompressedIndices = Section.CompressedIndices,
+        NumVertices = Section.NumCompressedVertices, NumIndices = Section.NumCompressedIndices]()
+    {
+        TArray<FDynamicMeshVertex> Vertices;
+        TArray<uint32> Indices;
+        Vertices.SetNumUninitialized(NumVertices);
+        Indices.SetNumUninitialized(NumIndices);
+        verify(FCompression::UncompressMemory(NAME_Oodle, Vertices.GetData(), NumVertices * sizeof(FDynamicMeshVertex), CompressedVertices.GetData(), CompressedVertices.Num()));
+        verify(FCompression::UncompressMemory(NAME_Oodle, Indices.GetData(), NumIndices * sizeof(uint32), CompressedIndices.GetData(), CompressedIndices.Num()));
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, SectionIndex, Serial, Vertices = MoveTemp(Vertices), Indices = MoveTemp(Indices)]() mutable
+        {
+            if (USimpleMeshComponent* Component = WeakThis.Get())
+            {
+                Component->FinishRestoreSection(SectionIndex, Serial, MoveTemp(Vertices), MoveTemp(Indices));
+            }
+        });
+    });
+}
+
+void USimpleMeshComponent::FinishRestoreSection(int32 SectionIndex, uint32 Serial, TArray<FDynamicMeshVertex>&& Vertices, TArray<uint32>&& Indices)
+{
+    // The section got new geometry or was replaced meanwhile
+    if (!MeshSections.IsValidIndex(SectionIndex) || MeshSections[SectionIndex].RestoreSerial != Serial)
+    {
+        return;
+    }
+
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    Section.VertexBuffer = MoveTemp(Vertices);
+    Section.IndexBuffer = MoveTemp(Indices);
+    Section.CompressedVertices.Empty();
+    Section.CompressedIndices.Empty();
+    Section.NumCompressedVertices = 0;
+    Section.NumCompressedIndices = 0;
+    Section.RestoreSerial = 0;
+    MarkSectionSnapshotStale(SectionIndex);
+
+    // Hidden again while decompressing: the geometry is back on the CPU, the render data waits for the next show
+    if (!Section.Visible)
+    {
+        return;
+    }
+
+    Section.bEvicted = false;
+    INC_DWORD_STAT(STAT_SimpleMesh_SectionRestores);
+    UpdateSectionProxy(SectionIndex);
+}
+
+void USimpleMeshComponent::SetSectionCastShadow(int32 SectionIndex, bool bNewCastShadow)
+{
+    if (!MeshSections.IsValidIndex(SectionIndex) || MeshSections[SectionIndex].bCastShadow == bNewCastShadow)
+    {
+        return;
+    }
+
+    MeshSections[SectionIndex].bCastShadow = bNewCastShadow;
+    if (SceneProxy && !IsRenderStateDirty())
+    {
+        FSimpleSceneProxy* SimpleProxy = static_cast<FSimpleSceneProxy*>(SceneProxy);
+        ENQUEUE_RENDER_COMMAND(FSimpleMeshSetSectionCastShadow)(
+            [SimpleProxy, SectionIndex, bNewCastShadow](FRHICommandListImmediate& RHICmdList)
+            {
+                SimpleProxy->SetSectionCastShadow_RenderThread(SectionIndex, bNewCastShadow);
+            });
+    }
+}
+
+void USimpleMeshComponent::SetSectionShadowMesh(int32 SectionIndex, const TArray<FVector>& Vertices, const TArray<int32>& Triangles)
+{
+    if (!MeshSections.IsValidIndex(SectionIndex))
+    {
+        return;
+    }
+
+    // Also drops a simplification still in flight
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    Section.ClearShadowMesh();
+
+    if (Vertices.Num() >= 3 && Triangles.Num() >= 3 && Triangles.Num() % 3 == 0)
+    {
+        // Shadow depths only read positions
+        Section.ShadowVertexBuffer.SetNum(Vertices.Num());
+        for (int32 VertIdx = 0; VertIdx < Vertices.Num(); VertIdx++)
+        {
+            Section.ShadowVertexBuffer[VertIdx].Position = FVector3f(Vertices[VertIdx]);
+        }
+
+        Section.ShadowIndexBuffer.Reserve(Triangles.Num());
+        for (const int32 Index : Triangles)
+        {
+            Section.ShadowIndexBuffer.Add(static_cast<uint32>(FMath::Clamp(Index, 0, Vertices.Num() - 1)));
+        }
+    }
+
+    UpdateSectionShadowProxy(SectionIndex);
+}
+
+void USimpleMeshComponent::GenerateSectionShadowMesh(int32 SectionIndex, float CellSize)
+{
+    if (!MeshSections.IsValidIndex(SectionIndex) || MeshSections[SectionIndex].VertexBuffer.Num() == 0 || CellSize <= 0.f)
+    {
+        return;
+    }
+
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    Section.ShadowMeshSerial = ++ShadowMeshSerialCounter;
+
+    FSimpleMeshSection Source;
+    Source.VertexBuffer = Section.VertexBuffer;
+    Source.IndexBuffer = Section.IndexBuffer;
+
+    Async(EAsyncExecution::ThreadPool, [WeakThis = TWeakObjectPtr<USimpleMeshComponent>(this), SectionIndex, Serial = Section.ShadowMeshSerial, CellSize, Source = MoveTemp(Source)]() mutable
+    {
+        // Vertex clustering: vertices closer than a cell collapse, and so do the triangles between them
+        const int32 NumTriangles = Source.IndexBuffer.Num() / 3;
+        SimpleMeshWeld::WeldSectionVertices(Source, CellSize);
+
+        // Not worth a second set of buffers
+        if (Source.IndexBuffer.Num() / 3 > NumTriangles * 3 / 4)
+        {
+            Source.VertexBuffer.Empty();
+            Source.IndexBuffer.Empty();
+        }
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, SectionIndex, Serial, Vertices = MoveTemp(Source.VertexBuffer), Indices = MoveTemp(Source.IndexBuffer)]() mutable
+        {
+            if (USimpleMeshComponent* Component = WeakThis.Get())
+            {
+                Component->FinishSectionShadowMesh(SectionIndex, Serial, MoveTemp(Vertices), MoveTemp(Indices));
+            }
+        });
+    });
+}
+
+void USimpleMeshComponent::RequestSectionShadowMesh(int32 SectionIndex)
+{
+    if (ShadowMeshCellSize > 0.f)
+    {
+        GenerateSectionShadowMesh(SectionIndex, ShadowMeshCellSize);
+    }
+}
+
+void USimpleMeshComponent::FinishSectionShadowMesh(int32 SectionIndex, uint32 Serial, TArray<FDynamicMeshVertex>&& Vertices, TArray<uint32>&& Indices)
+{
+    // The section got new geometry, or a shadow mesh of its own, meanwhile
+    if (!MeshSections.IsValidIndex(SectionIndex) || MeshSections[SectionIndex].ShadowMeshSerial != Serial)
+    {
+        return;
+    }
+
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    Section.ShadowVertexBuffer = MoveTemp(Vertices);
+    Section.ShadowIndexBuffer = MoveTemp(Indices);
+    Section.ShadowMeshSerial = 0;
+    UpdateSectionShadowProxy(SectionIndex);
+}
+
+void USimpleMeshComponent::UpdateSectionShadowProxy(int32 SectionIndex)
+{
+    // A proxy about to be recreated picks the change up anyway
+    if (SceneProxy == nullptr || IsRenderStateDirty())
+    {
+        MarkRenderStateDirty();
+        return;
+    }
+
+    FSimpleSceneProxy* SimpleProxy = static_cast<FSimpleSceneProxy*>(SceneProxy);
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    FSimpleMeshSceneSection* NewShadowSection = SimpleProxy->CreateShadowSceneSection(this, Section);
+
+    // Released with the rest of the geometry once on the GPU, later proxies draw the kept buffers
+    if (Section.bGeometryReleased && NewShadowSection)
+    {
+        Section.ShadowRenderBuffers = NewShadowSection->Buffers;
+        Section.ShadowVertexBuffer.Empty();
+        Section.ShadowIndexBuffer.Empty();
+    }
+    ENQUEUE_RENDER_COMMAND(FSimpleMeshSetSectionShadow)(
+        [SimpleProxy, SectionIndex, NewShadowSection](FRHICommandListImmediate& RHICmdList)
+        {
+            SimpleProxy->SetSectionShadow_RenderThread(SectionIndex, NewShadowSection);
+        });
+}
+
+void USimpleMeshComponent::SetSectionCollisionMesh(int32 SectionIndex, const TArray<FVector>& Vertices, const TArray<int32>& Triangles)
+{
+    if (!MeshSections.IsValidIndex(SectionIndex))
+    {
+        return;
+    }
+
+    // Also drops a decimation still in flight
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    Section.ClearCollisionMesh();
+
+    if (Vertices.Num() >= 3 && Triangles.Num() >= 3 && Triangles.Num() % 3 == 0)
+    {
+        Section.CollisionVertices.SetNumUninitialized(Vertices.Num());
+        for (int32 VertIdx = 0; VertIdx < Vertices.Num(); VertIdx++)
+        {
+            Section.CollisionVertices[VertIdx] = FVector3f(Vertices[VertIdx]);
+        }
+
+        Section.CollisionIndices.Reserve(Triangles.Num());
+        for (const int32 Index : Triangles)
+        {
+            Section.CollisionIndices.Add(static_cast<uint32>(FMath::Clamp(Index, 0, Vertices.Num() - 1)));
+        }
+        Section.bCustomCollisionMesh = true;
+    }
+    else if (Vertices.Num() > 0 || Triangles.Num() > 0)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("SetSectionCollisionMesh: %d vertices and %d indices are not a triangle mesh, section %d collides with its render triangles."),
+            Vertices.Num(), Triangles.Num(), SectionIndex);
+    }
+
+    if (Section.bEnableCollision)
+    {
+        UpdateCollision();
+    }
+}
+
+void USimpleMeshComponent::GenerateSectionCollisionMesh(int32 SectionIndex, float MaxError)
+{
+    if (!MeshSections.IsValidIndex(SectionIndex) || MeshSections[SectionIndex].IndexBuffer.Num() < 3 || MaxError <= 0.f)
+    {
+        return;
+    }
+
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    Section.bCustomCollisionMesh = false;
+    Section.CollisionMeshSerial = ++CollisionMeshSerialCounter;
+
+    // Released sections still have their positions when they have collision
+    TArray<FVector3f> Positions;
+    Positions.SetNumUninitialized(Section.GetNumVertices());
+    for (int32 VertIdx = 0; VertIdx < Positions.Num(); VertIdx++)
+    {
+        Positions[VertIdx] = Section.GetPosition(VertIdx);
+    }
+
+    Async(EAsyncExecution::ThreadPool, [WeakThis = TWeakObjectPtr<USimpleMeshComponent>(this), SectionIndex, Serial = Section.CollisionMeshSerial, MaxError, Positions = MoveTemp(Positions), Indices = Section.IndexBuffer]()
+    {
+        TArray<FVector3f> CollisionVertices;
+        TArray<uint32> CollisionIndices;
+        SimpleMeshSimplify::SimplifyMesh(Positions, Indices, MaxError, CollisionVertices, CollisionIndices);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, SectionIndex, Serial, Vertices = MoveTemp(CollisionVertices), Indices = MoveTemp(CollisionIndices)]() mutable
+        {
+            if (USimpleMeshComponent* Component = WeakThis.Get())
+            {
+                Component->FinishSectionCollisionMesh(SectionIndex, Serial, MoveTemp(Vertices), MoveTemp(Indices));
+            }
+        });
+    });
+}
+
+int32 USimpleMeshComponent::GetSectionCollisionTriangleCount(int32 SectionIndex) const
+{
+    if (!MeshSections.IsValidIndex(SectionIndex) || !MeshSections[SectionIndex].bEnableCollision)
+    {
+        return 0;
+    }
+
+    const FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    return (Section.HasCollisionMesh() ? Section.CollisionIndices.Num() : Section.IndexBuffer.Num()) / 3;
+}
+
+bool USimpleMeshComponent::RequestSectionCollisionMesh(int32 SectionIndex)
+{
+    if (CollisionSimplifyError <= 0.f || !MeshSections.IsValidIndex(SectionIndex) || !MeshSections[SectionIndex].bEnableCollision)
+    {
+        return false;
+    }
+
+    GenerateSectionCollisionMesh(SectionIndex, CollisionSimplifyError);
+    return MeshSections[SectionIndex].CollisionMeshSerial != 0;
+}
+
+void USimpleMeshComponent::FinishSectionCollisionMesh(int32 SectionIndex, uint32 Serial, TArray<FVector3f>&& Vertices, TArray<uint32>&& Indices)
+{
+    // The section got new geometry, or a collision mesh of its own, meanwhile
+    if (!MeshSections.IsValidIndex(SectionIndex) || MeshSections[SectionIndex].CollisionMeshSerial != Serial)
+    {
+        return;
+    }
+
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    Section.CollisionVertices = MoveTemp(Vertices);
+    Section.CollisionIndices = MoveTemp(Indices);
+    Section.CollisionMeshSerial = 0;
+
+    if (Section.bEnableCollision)
+    {
+        UpdateCollision();
+    }
+}
+
+bool USimpleMeshComponent::HasPendingCollisionMeshes() const
+{
+    for (const FSimpleMeshSection& Section : MeshSections)
+    {
+        if (Section.bEnableCollision && Section.CollisionMeshSerial != 0)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+void USimpleMeshComponent::SetSectionUseAsOccluder(int32 SectionIndex, bool bSectionUseAsOccluder)
+{
+    if (MeshSections.IsValidIndex(SectionIndex) && MeshSections[SectionIndex].bUseAsOccluder != bSectionUseAsOccluder)
+    {
+        MeshSections[SectionIndex].bUseAsOccluder = bSectionUseAsOccluder;
+        RequestOccluderUpdate();
+    }
+}
+
+void USimpleMeshComponent::RequestOccluderUpdate()
+{
+    if (!bUseAsOccluder)
+    {
+        if (OccluderData.IsValid())
+        {
+            FinishOccluderUpdate(nullptr);
+        }
+        return;
+    }
+
+    bOccluderUpdateDeferred = false;
+    if (bOccluderBuildInFlight)
+    {
+        bOccluderDirty = true;
+        return;
+    }
+
+    // Only the sections changed since the last publication are copied, the worker reads the snapshots
+    PublishSectionSnapshots();
+    const FSimpleMeshSnapshotPtr Snapshot = GetSnapshot();
+
+    // Hidden sections hide nothing
+    TArray<FSimpleMeshSectionSnapshotPtr> Sources;
+    for (auto It = MeshSections.CreateConstIterator(); It; ++It)
+    {
+        const FSimpleMeshSectionSnapshotPtr& SectionSnapshot = Snapshot->Sections[It.GetIndex()];
+        if (It->Visible && It->bUseAsOccluder && SectionSnapshot.IsValid() && SectionSnapshot->Indices.Num() >= 3)
+        {
+            Sources.Add(SectionSnapshot);
+        }
+    }
+
+    if (Sources.Num() == 0)
+    {
+        FinishOccluderUpdate(nullptr);
+        return;
+    }
+
+    bOccluderBuildInFlight = true;
+    bOccluderDirty = false;
+    Async(EAsyncExecution::ThreadPool, [WeakThis = TWeakObjectPtr<USimpleMeshComponent>(this), Sources = MoveTemp(Sources),
+        MaxTriangles = OccluderMaxTriangles, MinTriangleArea = OccluderMinTriangleArea]()
+    {
+        TSharedPtr<FSimpleMeshOccluderData, ESPMode::ThreadSafe> NewOccluderData = SimpleMeshOccluder::Build(Sources, MaxTriangles, MinTriangleArea);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, NewOccluderData = MoveTemp(NewOccluderData)]() mutable
+        {
+            if (USimpleMeshComponent* Component = WeakThis.Get())
+            {
+                Component->bOccluderBuildInFlight = false;
+                Component->FinishOccluderUpdate(MoveTemp(NewOccluderData));
+                if (Component->bOccluderDirty)
+                {
+                    Component->RequestOccluderUpdate();
+                }
+            }
+        });
+    });
+}
+
+void USimpleMeshComponent::DeferOccluderUpdate()
+{
+    if (!bUseAsOccluder || bOccluderUpdateDeferred)
+    {
+        return;
+    }
+
+    bOccluderUpdateDeferred = true;
+    FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateWeakLambda(this, [this](float)
+    {
+        // A topology change may have built it meanwhile
+        if (bOccluderUpdateDeferred)
+        {
+            RequestOccluderUpdate();
+        }
+        return false;
+    }), FMath::Max(GSimpleMeshOccluderDeformDelay, 0.f));
+}
+
+void USimpleMeshComponent::FinishOccluderUpdate(TSharedPtr<FSimpleMeshOccluderData, ESPMode::ThreadSafe> NewOccluderData)
+{
+    OccluderData = NewOccluderData;
+
+    // A proxy created later picks it up from the component
+    if (SceneProxy)
+    {
+        FSimpleSceneProxy* Proxy = static_cast<FSimpleSceneProxy*>(SceneProxy);
+        ENQUEUE_RENDER_COMMAND(FSimpleMeshSetOccluderData)([Proxy, NewOccluderData = MoveTemp(NewOccluderData)](FRHICommandListImmediate& RHICmdList) mutable
+        {
+            Proxy->SetOccluderData_RenderThread(MoveTemp(NewOccluderData));
+        });
+    }
+}
+
+bool USimpleMeshComponent::DoesSectionExist(int32 SectionIndex) const
+{
+    return MeshSections.IsValidIndex(SectionIndex) ;
+}
+
+int32 USimpleMeshComponent::GetNumSections() const
+{
+    return MeshSections.GetMaxIndex();
+}
+
+void USimpleMeshComponent::AddCollisionConvexMesh(const TArray<FVector>& ConvexVerts)
+{
+    if (ConvexVerts.Num() >= 4)
+    {
+        // New element
+        FKConvexElem NewConvexElem;
+        // Copy in vertex info
+        NewConvexElem.VertexData = ConvexVerts;
+        // Update bounding box
+        NewConvexElem.ElemBox = FBox(ConvexVerts);
+        // Add to array of convex elements
+        CollisionConvexElems.Add(NewConvexElem);
+        // Refresh collision
+        UpdateCollision();
+    }
+}
+
+
+
+void USimpleMeshComponent::UpdateCollision()
+{
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_UpdateCollision);
+
+    // Cooking now would cook the full render triangles, FinishSectionCollisionMesh comes back here
+    if (HasPendingCollisionMeshes())
+    {
+        return;
+    }
+    
+    UWorld* World = GetWorld();
+    const bool bUseAsyncCook = World && World->IsGameWorld() && bUseAsyncCooking;
+    if (bUseAsyncCook)
+    {
+        // Debounced and throttled with the cooks of the other components, StartAsyncCollisionCook is called when our turn comes
+        FSimpleMeshCookScheduler::Get().RequestCook(this);
+        return;
+    }
+
+    FSimpleMeshCookScheduler::Get().CancelCook(this);
+    AsyncBodySetupQueue.Empty();	//If for some reason we modified the async at runtime, just clear any pending async body setups
+    CreateSimpleMeshBodySetup(); 
+    CookCollision(SimpleMeshBodySetup, false);
+}
+
+void USimpleMeshComponent::StartAsyncCollisionCook()
+{
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_UpdateCollision);
+
+    // The scheduler runs one cook per component at a time, anything still queued here is from before
+    for (UBodySetup* OldBody : AsyncBodySetupQueue)
+    {
+        OldBody->AbortPhysicsMeshAsyncCreation();
+    }
+
+    UBodySetup* UseBodySetup = AcquireBodySetup();
+    AsyncBodySetupQueue.Add(UseBodySetup);
+    CookCollision(UseBodySetup, true);
+}
+
+void USimpleMeshComponent::CookCollision(UBodySetup* UseBodySetup, bool bUseAsyncCook)
+{
+    const bool bAutoConvex = bAutoGenerateConvexCollision && !bUseComplexAsSimpleCollision;
+    FTriMeshCollisionData CollisionData;
+    const uint64 GeometryHash = (bUseCollisionCache || bAutoConvex) ? ComputeCollisionGeometryHash(CollisionData) : 0;
+
+    // Generated hulls follow the geometry, they are swapped in once ready
+    if (bAutoConvex)
+    {
+        RequestConvexDecomposition(GeometryHash, MoveTemp(CollisionData));
+    }
+    else
+    {
+        AutoConvexElems.Reset();
+        DecomposedGeometryHash = 0;
+        ConvexDecompositionSerial++;
+    }
+
+    // Fill in simple collision convex elements
+    UseBodySetup->AggGeom.ConvexElems = CollisionConvexElems;
+    UseBodySetup->AggGeom.ConvexElems.Append(AutoConvexElems);
+
+    // Set trace flag
+    UseBodySetup->CollisionTraceFlag = bUseComplexAsSimpleCollision ? CTF_UseComplexAsSimple : CTF_UseDefault;
+
+    // Same geometry, same GUID: lets a previous cook of this exact shape be reused
+    UseBodySetup->BodySetupGuid = bUseCollisionCache && GeometryHash != 0 ? MakeBodySetupGuid(GeometryHash, UseBodySetup->AggGeom.ConvexElems) : FGuid::NewGuid();
+
+    if (bUseCollisionCache && FSimpleMeshCollisionCache::Get().TryApply(GeometryHash, UseBodySetup))
+    {
+        UseBodySetup->bHasCookedCollisionData = true;
+        if (bUseAsyncCook)
+        {
+            FinishPhysicsAsyncCook(true, UseBodySetup, GeometryHash, AutoConvexElems.Num());
+        }
+        else
+        {
+            RecreatePhysicsState();
+        }
+        return;
+    }
+
+    if (bUseAsyncCook)
+    {
+        
+        UseBodySetup->CreatePhysicsMeshesAsync(FOnAsyncPhysicsCookFinished::CreateUObject(this, &USimpleMeshComponent::FinishPhysicsAsyncCook, UseBodySetup, GeometryHash, AutoConvexElems.Num()));
+    }
+    else
+    {
+        // Also we want cooked data for this
+        UseBodySetup->bHasCookedCollisionData = true;
+        UseBodySetup->InvalidatePhysicsData();
+        UseBodySetup->CreatePhysicsMeshes();
+        VerifyCookedConvexElems(UseBodySetup, AutoConvexElems.Num());
+        if (bUseCollisionCache)
+        {
+            FSimpleMeshCollisionCache::Get().Store(GeometryHash, UseBodySetup);
+        }
+        RecreatePhysicsState();
+    }
+}
+
+uint64 USimpleMeshComponent::ComputeCollisionGeometryHash(FTriMeshCollisionData& OutCollisionData)
+{
+    // Hash exactly what the cooker is going to be fed
+    if (!ContainsPhysicsTriMeshData(true) || !GetPhysicsTriMeshData(&OutCollisionData, true))
+    {
+        return 0;
+    }
+
+    const uint32 CookFlags = (bUseComplexAsSimpleCollision ? 1u : 0u)
+        | (OutCollisionData.bFlipNormals ? 2u : 0u)
+        | (OutCollisionData.bFastCook ? 4u : 0u)
+        | (OutCollisionData.bDeformableMesh ? 8u : 0u);
+
+    return FSimpleMeshCollisionCache::ComputeGeometryHash(OutCollisionData, CookFlags);
+}
+
+FGuid USimpleMeshComponent::MakeBodySetupGuid(uint64 GeometryHash, const TArray<FKConvexElem>& ConvexElems)
+{
+    // The convex elements are cooked along with the trimesh, a GUID of the trimesh alone would return stale hulls
+    FXxHash64Builder Builder;
+    Builder.Update(&GeometryHash, sizeof(GeometryHash));
+    for (const FKConvexElem& ConvexElem : ConvexElems)
+    {
+        const int32 NumVertices = ConvexElem.VertexData.Num();
+        Builder.Update(&NumVertices, sizeof(NumVertices));
+        Builder.Update(ConvexElem.VertexData.GetData(), NumVertices * sizeof(FVector));
+    }
+
+    const uint64 Hash = Builder.Finalize().Hash;
+    return FGuid((uint32)(Hash >> 32), (uint32)Hash, 0x534D4348, (uint32)ConvexElems.Num());
+}
+
+void USimpleMeshComponent::RequestConvexDecomposition(uint64 GeometryHash, FTriMeshCollisionData&& CollisionData)
+{
+    if (GeometryHash == DecomposedGeometryHash)
+    {
+        return;
+    }
+
+    DecomposedGeometryHash = GeometryHash;
+    const uint32 Serial = ++ConvexDecompositionSerial;
+
+    // Gathered by ComputeCollisionGeometryHash, empty when there is no trimesh
+    if (GeometryHash == 0 || CollisionData.Vertices.Num() == 0)
+    {
+        AutoConvexElems.Reset();
+        return;
+    }
+
+    TArray<uint32> Indices;
+    Indices.Reserve(CollisionData.Indices.Num() * 3);
+    for (const FTriIndices& Triangle : CollisionData.Indices)
+    {
+        Indices.Add(Triangle.v0);
+        Indices.Add(Triangle.v1);
+        Indices.Add(Triangle.v2);
+    }
+
+    // The previous hulls stay in use until the new ones are ready
+    Async(EAsyncExecution::ThreadPool, [WeakThis = TWeakObjectPtr<USimpleMeshComponent>(this), Serial, Settings = ConvexDecompositionSettings,
+        Positions = MoveTemp(CollisionData.Vertices), Indices = MoveTemp(Indices)]()
+    {
+        TArray<TArray<FVector>> Hulls;
+        SimpleMeshConvexDecomposition::Decompose(Positions, Indices, Settings, Hulls);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Hulls = MoveTemp(Hulls)]() mutable
+        {
+            if (USimpleMeshComponent* Component = WeakThis.Get())
+            {
+                Component->FinishConvexDecomposition(Serial, MoveTemp(Hulls));
+            }
+        });
+    });
+}
+
+void USimpleMeshComponent::FinishConvexDecomposition(uint32 Serial, TArray<TArray<FVector>>&& Hulls)
+{
+    if (Serial != ConvexDecompositionSerial)
+    {
+        return;
+    }
+
+    AutoConvexElems.Reset(Hulls.Num());
+    for (TArray<FVector>& Hull : Hulls)
+    {
+        FKConvexElem NewConvexElem;
+        NewConvexElem.VertexData = MoveTemp(Hull);
+        NewConvexElem.ElemBox = FBox(NewConvexElem.VertexData);
+
+        AutoConvexElems.Add(NewConvexElem);
+    }
+
+    // Same trimesh, new hulls: they change the GUID of the next body setup, see MakeBodySetupGuid
+    UpdateCollision();
+}
+
+UBodySetup* USimpleMeshComponent::CreateBodySetupHelper()
+{
+    // The body setup in a template needs to be public since the property is Tnstanced and thus is the archetype of the instance meaning there is a direct reference
+    UBodySetup* NewBodySetup = NewObject<UBodySetup>(this, NAME_None, (IsTemplate() ? RF_Public | RF_ArchetypeObject : RF_NoFlags));
+    NewBodySetup->BodySetupGuid = FGuid::NewGuid();
+
+    NewBodySetup->bGenerateMirroredCollision = false;
+    NewBodySetup->bDoubleSidedGeometry = true;
+    NewBodySetup->CollisionTraceFlag = bUseComplexAsSimpleCollision ? CTF_UseComplexAsSimple : CTF_UseDefault;
+
+    return NewBodySetup;
+}
+
+
+UBodySetup* USimpleMeshComponent::AcquireBodySetup()
+{
+    if (BodySetupPool.Num() > 0)
+    {
+        UBodySetup* BodySetup = BodySetupPool.Pop(false);
+        BodySetup->CollisionTraceFlag = bUseComplexAsSimpleCollision ? CTF_UseComplexAsSimple : CTF_UseDefault;
+        return BodySetup;
+    }
+    return CreateBodySetupHelper();
+}
+
+void USimpleMeshComponent::RecycleBodySetup(UBodySetup* BodySetup)
+{
+    if (!BodySetup || BodySetup == SimpleMeshBodySetup || BodySetupPool.Num() >= MaxPooledBodySetups)
+    {
+        return; // left to the GC
+    }
+
+    // Drop the cooked meshes and shapes, the object itself is all we keep
+    BodySetup->InvalidatePhysicsData();
+    BodySetup->AggGeom.EmptyElements();
+    BodySetupPool.AddUnique(BodySetup);
+}
+
+void USimpleMeshComponent::RetireBodySetup(UBodySetup* BodySetup)
+{
+    if (!BodySetup || BodySetup == SimpleMeshBodySetup)
+    {
+        return;
+    }
+
+    if (!SceneProxy)
+    {
+        RecycleBodySetup(BodySetup);
+        return;
+    }
+
+    // Kept referenced meanwhile, the GC takes it if the component goes first
+    RetiringBodySetups.Add(BodySetup);
+    FSimpleSceneProxy* Proxy = static_cast<FSimpleSceneProxy*>(SceneProxy);
+    ENQUEUE_RENDER_COMMAND(FSimpleMeshSetBodySetup)([Proxy, NewBodySetup = SimpleMeshBodySetup.Get(), WeakThis = TWeakObjectPtr<USimpleMeshComponent>(this), BodySetup](FRHICommandListImmediate& RHICmdList)
+    {
+        Proxy->SetBodySetup_RenderThread(NewBodySetup);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, BodySetup]()
+        {
+            USimpleMeshComponent* Component = WeakThis.Get();
+            if (Component && Component->RetiringBodySetups.RemoveSingleSwap(BodySetup) > 0)
+            {
+                Component->RecycleBodySetup(BodySetup);
+            }
+        });
+    });
+}
+
+void USimpleMeshComponent::CreateSimpleMeshBodySetup()
+{
+    if (SimpleMeshBodySetup == nullptr)
+    {
+        SimpleMeshBodySetup = CreateBodySetupHelper();
+    }
+}
+
+void USimpleMeshComponent::VerifyCookedConvexElems(const UBodySetup* CookedBodySetup, int32 NumAutoConvexElems) const
+{
+    const int32 NumExpected = CookedBodySetup->AggGeom.ConvexElems.Num();
+    int32 NumCooked = 0;
+    for (const FKConvexElem& ConvexElem : CookedBodySetup->AggGeom.ConvexElems)
+    {
+        NumCooked += ConvexElem.GetChaosConvexMesh().IsValid() ? 1 : 0;
+    }
+
+    // Hulls passed to AddCollisionConvexMesh may be degenerate and fail to cook, that is bad input rather than a broken cook
+    if (NumCooked != NumExpected || NumAutoConvexElems > NumExpected)
+    {
+        UE_LOG(LogSimpleComponent, Warning, TEXT("%s: %d of %d convex elements cooked, %d of them generated by the decomposition."), *GetPathName(), NumCooked, NumExpected, NumAutoConvexElems);
+    }
+}
+
+void USimpleMeshComponent::FinishPhysicsAsyncCook(bool bSuccess, UBodySetup* FinishedBodySetup, uint64 GeometryHash, int32 NumAutoConvexElems)
+{
+    // The scheduler tracks the latest cook only, older ones were superseded
+    if (AsyncBodySetupQueue.Num() > 0 && AsyncBodySetupQueue.Last() == FinishedBodySetup)
+    {
+        FSimpleMeshCookScheduler::Get().NotifyCookFinished(this, bSuccess);
+    }
+
+    TArray<UBodySetup*> NewQueue;
+    NewQueue.Reserve(AsyncBodySetupQueue.Num());
+
+    int32 FoundIdx;
+    if (AsyncBodySetupQueue.Find(FinishedBodySetup, FoundIdx))
+    {
+        if (bSuccess)
+        {
+            VerifyCookedConvexElems(FinishedBodySetup, NumAutoConvexElems);
+
+            //The new body was found in the array meaning it's newer so use it
+            UBodySetup* PreviousBodySetup = SimpleMeshBodySetup;
+            SimpleMeshBodySetup = FinishedBodySetup;
+            if (bUseCollisionCache)
+            {
+                FSimpleMeshCollisionCache::Get().Store(GeometryHash, FinishedBodySetup);
+            }
+            RecreatePhysicsState();
+
+            // The physics state no longer references it, the proxy may until it gets the new one
+            RetireBodySetup(PreviousBodySetup);
+
+            //remove any async body setups that were requested before this one
+            for (int32 AsyncIdx = FoundIdx + 1; AsyncIdx < AsyncBodySetupQueue.Num(); ++AsyncIdx)
+            {
+                NewQueue.Add(AsyncBodySetupQueue[AsyncIdx]);
+            }
+
+            AsyncBodySetupQueue = NewQueue;
+        }
+        else
+        {
+            AsyncBodySetupQueue.RemoveAt(FoundIdx);
+            RecycleBodySetup(FinishedBodySetup);
+        }
+    }
+}
+
+void USimpleMeshComponent::SetCollisionConvexMeshes(const TArray< TArray<FVector> >& ConvexMeshes)
+{
+    CollisionConvexElems.Reset();
+
+    // Create element for each convex mesh
+    for (int32 ConvexIndex = 0; ConvexIndex < ConvexMeshes.Num(); ConvexIndex++)
+    {
+        FKConvexElem NewConvexElem;
+        NewConvexElem.VertexData = ConvexMeshes[ConvexIndex];
+        NewConvexElem.ElemBox = FBox(NewConvexElem.VertexData);
+
+        CollisionConvexElems.Add(NewConvexElem);
+    }
+
+    UpdateCollision();
+}
+
+
+void USimpleMeshComponent::ClearCollisionConvexMeshes()
+{
+    // Empty simple collision info
+    CollisionConvexElems.Empty();
+    // Refresh collision
+    UpdateCollision();
+}
+
+
+
+bool USimpleMeshComponent::GetPhysicsTriMeshData(struct FTriMeshCollisionData* CollisionData, bool InUseAllTriData)
+{
+    int32 VertexBase = 0; // Base vertex index for current section
+
+    // For each section..
+    for (TSparseArray<FSimpleMeshSection>::TIterator It(MeshSections); It; ++It)
+    {
+        const int32 SectionCnt = It.GetIndex();
+        FSimpleMeshSection& Section = *It;
+        // Do we have collision enabled?
+        if (Section.bEnableCollision)
+        {
+            // The collision mesh of the section if it has one, its render triangles otherwise
+            const bool bUseCollisionMesh = Section.HasCollisionMesh();
+            const TArray<uint32>& CollisionIndices = bUseCollisionMesh ? Section.CollisionIndices : Section.IndexBuffer;
+
+            // Copy vert data
+            if (bUseCollisionMesh)
+            {
+                CollisionData->Vertices.Append(Section.CollisionVertices);
+            }
+            else
+            {
+                for (int32 VertIdx = 0; VertIdx < Section.GetNumVertices(); VertIdx++)
+                {
+                    CollisionData->Vertices.Add(Section.GetPosition(VertIdx));
+                }
+            }
+
+            // Copy triangle data
+            const int32 NumTriangles = CollisionIndices.Num() / 3;
+            for (int32 TriIdx = 0; TriIdx < NumTriangles; TriIdx++)
+            {
+                // Need to add base offset for indices
+                FTriIndices Triangle;
+                Triangle.v0 = CollisionIndices[(TriIdx * 3) + 0] + VertexBase;
+                Triangle.v1 = CollisionIndices[(TriIdx * 3) + 1] + VertexBase;
+                Triangle.v2 = CollisionIndices[(TriIdx * 3) + 2] + VertexBase;
+                CollisionData->Indices.Add(Triangle);
+
+                // Also store material info
+                CollisionData->MaterialIndices.Add(SectionCnt);
+
+            }
+
+            // Remember the base index that new verts will be added from in next section
+            VertexBase = CollisionData->Vertices.Num();
+        }
+    }
+
+    CollisionData->bFlipNormals = true;
+    CollisionData->bDeformableMesh = true;
+    CollisionData->bFastCook = true;
+    return true;
+}
+
+bool USimpleMeshComponent::ContainsPhysicsTriMeshData(bool InUseAllTriData) const
+{
+    for (const FSimpleMeshSection& Section : MeshSections)
+    {
+        if ((Section.IndexBuffer.Num() >= 3 || Section.HasCollisionMesh()) && Section.bEnableCollision)
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+
+void USimpleMeshComponent::SetSimpleMeshSection(int32 SectionIndex, const FSimpleMeshSection& Section)
+{
+    if (SectionIndex < 0)
+    {
+        return;
+    }
+
+    // Occupy the slot if it is free
+    if (MeshSections.IsValidIndex(SectionIndex))
+    {
+        MeshSections[SectionIndex] = Section;
+    }
+    else
+    {
+        MeshSections.Insert(SectionIndex, Section);
+    }
+
+    // The caller may not have filled in the box, rebuild it from the vertices
+    FSimpleMeshSection& NewSection = MeshSections[SectionIndex];
+    NewSection.SectionLocalBox.Init();
+    for (const FDynamicMeshVertex& Vertex : NewSection.VertexBuffer)
+    {
+        NewSection.SectionLocalBox += FVector(Vertex.Position);
+    }
+
+    NewSection.NormalAdjacency.Reset();
+    NewSection.PositionsHash = 0;
+    NewSection.IndicesHash = 0;
+    NewSection.BVH.Reset();
+    NewSection.bBVHNeedsRefit = false;
+    if (NewSection.bGenerateNormals)
+    {
+        SimpleMeshNormals::ComputeSectionNormals(NewSection);
+    }
+
+    UpdateLocalBounds(); // Update overall bounds
+    UpdateCollision(); // Mark collision as dirty
+    UpdateSectionProxy(SectionIndex); // Only this slot of the proxy is rebuilt
+}
+
+
+FSimpleMeshSection* USimpleMeshComponent::GetSimpleMeshSection(int32 SectionIndex)
+{
+    if (MeshSections.IsValidIndex(SectionIndex))
+    {
+        return &MeshSections[SectionIndex];
     }
     else
     {
-        // New GUID as collision has changed
-        UseBodySetup->BodySetupGuid = FGuid::NewGuid();
-        // Also we want cooked data for this
-        UseBodySetup->bHasCookedCollisionData = true;
-        UseBodySetup->InvalidatePhysicsData();
-        UseBodySetup->CreatePhysicsMeshes();
-        RecreatePhysicsState();
+        return nullptr;
     }
 }
 
 
-UBodySetup* USimpleMeshComponent::CreateBodySetupHelper()
+UBodySetup* USimpleMeshComponent::GetBodySetup()
 {
-    // The body setup in a template needs to be public since the property is Tnstanced and thus is the archetype of the instance meaning there is a direct reference
-    UBodySetup* NewBodySetup = NewObject<UBodySetup>(this, NAME_None, (IsTemplate() ? RF_Public | RF_ArchetypeObject : RF_NoFlags));
-    NewBodySetup->BodySetupGuid = FGuid::NewGuid();
-
-    NewBodySetup->bGenerateMirroredCollision = false;
-    NewBodySetup->bDoubleSidedGeometry = true;
-    NewBodySetup->CollisionTraceFlag = bUseComplexAsSimpleCollision ? CTF_UseComplexAsSimple : CTF_UseDefault;
-
-    return NewBodySetup;
+    CreateSimpleMeshBodySetup();
+    return SimpleMeshBodySetup;
 }
 
 
-void USimpleMeshComponent::CreateSimpleMeshBodySetup()
+void USimpleMeshComponent::DeformSection(int32 SectionIndex, TFunctionRef<void(int32 VertexIndex, FVector3f& Position)> DeformFunc, bool bUpdateCollision)
 {
-    if (SimpleMeshBodySetup == nullptr)
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_DeformSection);
+
+    // Released sections have no CPU positions left, their box stays as it was
+    if (!MeshSections.IsValidIndex(SectionIndex) || MeshSections[SectionIndex].VertexBuffer.Num() == 0)
     {
-        SimpleMeshBodySetup = CreateBodySetupHelper();
+        return;
+    }
+
+    TArray<FDynamicMeshVertex>& Vertices = MeshSections[SectionIndex].VertexBuffer;
+    const int32 NumVertices = Vertices.Num();
+    const int32 NumBlocks = FMath::DivideAndRoundUp(NumVertices, DeformBlockSize);
+
+    TArray<FBox3f> BlockBoxes;
+    BlockBoxes.SetNumUninitialized(NumBlocks);
+
+    ParallelFor(NumBlocks, [&](int32 BlockIndex)
+    {
+        const int32 First = BlockIndex * DeformBlockSize;
+        const int32 Last = FMath::Min(First + DeformBlockSize, NumVertices);
+
+        FBox3f BlockBox(ForceInit);
+        for (int32 VertIdx = First; VertIdx < Last; VertIdx++)
+        {
+            FVector3f& Position = Vertices[VertIdx].Position;
+            DeformFunc(VertIdx, Position);
+            BlockBox += Position;
+        }
+        BlockBoxes[BlockIndex] = BlockBox;
+    });
+
+    FBox3f SectionBox(ForceInit);
+    for (const FBox3f& BlockBox : BlockBoxes)
+    {
+        SectionBox += BlockBox;
     }
+
+    FinishSectionDeform(SectionIndex, SectionBox, bUpdateCollision);
 }
 
-void USimpleMeshComponent::FinishPhysicsAsyncCook(bool bSuccess, UBodySetup* FinishedBodySetup)
+void USimpleMeshComponent::DeformSectionBlocks(int32 SectionIndex, TFunctionRef<void(int32 FirstVertexIndex, TArrayView<FVector3f> Positions)> BlockFunc, bool bUpdateCollision)
 {
-    TArray<UBodySetup*> NewQueue;
-    NewQueue.Reserve(AsyncBodySetupQueue.Num());
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_DeformSection);
 
-    int32 FoundIdx;
-    if (AsyncBodySetupQueue.Find(FinishedBodySetup, FoundIdx))
+    // Released sections have no CPU positions left, their box stays as it was
+    if (!MeshSections.IsValidIndex(SectionIndex) || MeshSections[SectionIndex].VertexBuffer.Num() == 0)
     {
-        if (bSuccess)
-        {
-            //The new body was found in the array meaning it's newer so use it
-            SimpleMeshBodySetup = FinishedBodySetup;
-            RecreatePhysicsState();
+        return;
+    }
 
-            //remove any async body setups that were requested before this one
-            for (int32 AsyncIdx = FoundIdx + 1; AsyncIdx < AsyncBodySetupQueue.Num(); ++AsyncIdx)
-            {
-                NewQueue.Add(AsyncBodySetupQueue[AsyncIdx]);
-            }
+    TArray<FDynamicMeshVertex>& Vertices = MeshSections[SectionIndex].VertexBuffer;
+    const int32 NumVertices = Vertices.Num();
+    const int32 NumBlocks = FMath::DivideAndRoundUp(NumVertices, DeformBlockSize);
 
-            AsyncBodySetupQueue = NewQueue;
+    // Packed scratch memory handed to the callback, each block only touches its own slice
+    TArray<FVector3f> Positions;
+    Positions.SetNumUninitialized(NumVertices);
+    TArray<FBox3f> BlockBoxes;
+    BlockBoxes.SetNumUninitialized(NumBlocks);
+
+    ParallelFor(NumBlocks, [&](int32 BlockIndex)
+    {
+        const int32 First = BlockIndex * DeformBlockSize;
+        const int32 Count = FMath::Min(DeformBlockSize, NumVertices - First);
+
+        // Gather into a packed block, let the callback work on it, then scatter back
+        for (int32 Offset = 0; Offset < Count; Offset++)
+        {
+            Positions[First + Offset] = Vertices[First + Offset].Position;
         }
-        else
+
+        BlockFunc(First, TArrayView<FVector3f>(Positions.GetData() + First, Count));
+
+        FBox3f BlockBox(ForceInit);
+        for (int32 Offset = 0; Offset < Count; Offset++)
         {
-            AsyncBodySetupQueue.RemoveAt(FoundIdx);
+            const FVector3f& Position = Positions[First + Offset];
+            Vertices[First + Offset].Position = Position;
+            BlockBox += Position;
         }
+        BlockBoxes[BlockIndex] = BlockBox;
+    });
+
+    FBox3f SectionBox(ForceInit);
+    for (const FBox3f& BlockBox : BlockBoxes)
+    {
+        SectionBox += BlockBox;
     }
+
+    FinishSectionDeform(SectionIndex, SectionBox, bUpdateCollision);
 }
 
-void USimpleMeshComponent::SetCollisionConvexMeshes(const TArray< TArray<FVector> >& ConvexMeshes)
+void USimpleMeshComponent::RecomputeSectionNormals(int32 SectionIndex)
 {
-    CollisionConvexElems.Reset();
+    if (!MeshSections.IsValidIndex(SectionIndex))
+    {
+        return;
+    }
 
-    // Create element for each convex mesh
-    for (int32 ConvexIndex = 0; ConvexIndex < ConvexMeshes.Num(); ConvexIndex++)
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    Section.bGenerateNormals = true;
+    SimpleMeshNormals::ComputeSectionNormals(Section);
+
+    Section.DirtyVertexRanges.Reset();
+    MarkSectionPositionsDirty(SectionIndex, 0, Section.VertexBuffer.Num());
+}
+
+int32 USimpleMeshComponent::WeldMeshSection(int32 SectionIndex, float Tolerance)
+{
+    if (!MeshSections.IsValidIndex(SectionIndex))
     {
-        FKConvexElem NewConvexElem;
-        NewConvexElem.VertexData = ConvexMeshes[ConvexIndex];
-        NewConvexElem.ElemBox = FBox(NewConvexElem.VertexData);
+        return 0;
+    }
 
-        CollisionConvexElems.Add(NewConvexElem);
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    const int32 NumRemoved = SimpleMeshWeld::WeldSectionVertices(Section, Tolerance);
+    if (NumRemoved == 0)
+    {
+        return 0;
+    }
+    NumWeldedVertices += NumRemoved;
+    Section.PositionsHash = 0;
+    Section.IndicesHash = 0;
+
+    Section.DirtyVertexRanges.Reset();
+    Section.NormalAdjacency.Reset();
+    Section.BVH.Reset();
+    Section.bBVHNeedsRefit = false;
+    if (Section.bGenerateNormals)
+    {
+        SimpleMeshNormals::ComputeSectionNormals(Section);
     }
 
+    UpdateLocalBounds();
     UpdateCollision();
+    UpdateSectionProxy(SectionIndex);
+    return NumRemoved;
 }
 
-
-void USimpleMeshComponent::ClearCollisionConvexMeshes()
+void USimpleMeshComponent::WeldIngestedSection(FSimpleMeshSection& Section)
 {
-    // Empty simple collision info
-    CollisionConvexElems.Empty();
-    // Refresh collision
-    UpdateCollision();
+    if (bWeldVertices)
+    {
+        NumWeldedVertices += SimpleMeshWeld::WeldSectionVertices(Section, WeldTolerance);
+    }
 }
 
-
-
-bool USimpleMeshComponent::GetPhysicsTriMeshData(struct FTriMeshCollisionData* CollisionData, bool InUseAllTriData)
+const FSimpleMeshBVH* USimpleMeshComponent::GetSectionBVH(int32 SectionIndex)
 {
-    int32 VertexBase = 0; // Base vertex index for current section
+    if (!MeshSections.IsValidIndex(SectionIndex) || MeshSections[SectionIndex].IndexBuffer.Num() < 3)
+    {
+        return nullptr;
+    }
 
-    // For each section..
-    for (int32 SectionCnt = 0; SectionCnt < MeshSections.Num(); SectionCnt++)
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    if (!Section.BVH.IsValid())
     {
-        FSimpleMeshSection& Section = MeshSections[SectionCnt];
-        // Do we have collision enabled?
-        if (Section.bEnableCollision)
+        Section.BVH = MakeShared<FSimpleMeshBVH, ESPMode::ThreadSafe>();
+        Section.BVH->Build(Section.VertexBuffer, Section.IndexBuffer);
+    }
+    else if (Section.bBVHNeedsRefit)
+    {
+        // Copies of the section still point to the old positions
+        if (!Section.BVH.IsUnique())
         {
+            Section.BVH = MakeShared<FSimpleMeshBVH, ESPMode::ThreadSafe>(*Section.BVH);
+        }
+        Section.BVH->Refit(Section.VertexBuffer, Section.IndexBuffer);
+    }
+    Section.bBVHNeedsRefit = false;
 
+    return Section.BVH->IsEmpty() ? nullptr : Section.BVH.Get();
+}
 
-            // Copy vert data
-            for (int32 VertIdx = 0; VertIdx < Section.VertexBuffer.Num(); VertIdx++)
-            {
-                CollisionData->Vertices.Add((FVector3f)Section.VertexBuffer[VertIdx].Position);
-
-            }
+bool USimpleMeshComponent::RaycastSections(FVector Start, FVector End, FSimpleMeshQueryHit& OutHit, bool bVisibleOnly)
+{
+    const FTransform& Transform = GetComponentTransform();
+    const FVector LocalStart = Transform.InverseTransformPosition(Start);
+    const FVector LocalEnd = Transform.InverseTransformPosition(End);
+    const FVector LocalDelta = LocalEnd - LocalStart;
+    const double LocalLength = LocalDelta.Size();
+    if (LocalLength <= UE_SMALL_NUMBER)
+    {
+        return false;
+    }
+    const FVector LocalDirection = LocalDelta / LocalLength;
 
-            // Copy triangle data
-            const int32 NumTriangles = Section.IndexBuffer.Num() / 3;
-            for (int32 TriIdx = 0; TriIdx < NumTriangles; TriIdx++)
-            {
-                // Need to add base offset for indices
-                FTriIndices Triangle;
-                Triangle.v0 = Section.IndexBuffer[(TriIdx * 3) + 0] + VertexBase;
-                Triangle.v1 = Section.IndexBuffer[(TriIdx * 3) + 1] + VertexBase;
-                Triangle.v2 = Section.IndexBuffer[(TriIdx * 3) + 2] + VertexBase;
-                CollisionData->Indices.Add(Triangle);
+    float BestDistance = (float)LocalLength;
+    FSimpleMeshBVHHit BestHit;
+    int32 BestSection = INDEX_NONE;
 
-                // Also store material info
-                CollisionData->MaterialIndices.Add(SectionCnt);
+    for (auto It = MeshSections.CreateConstIterator(); It; ++It)
+    {
+        const int32 SectionIndex = It.GetIndex();
+        if ((bVisibleOnly && !It->Visible) || !It->SectionLocalBox.IsValid)
+        {
+            continue;
+        }
 
-            }
+        // The section box is cheaper than the BVH root, and skips building BVHs nobody hits
+        if (!FMath::LineBoxIntersection(It->SectionLocalBox.ExpandBy(UE_KINDA_SMALL_NUMBER), LocalStart, LocalStart + LocalDirection * BestDistance, LocalDirection * BestDistance))
+        {
+            continue;
+        }
 
-            // Remember the base index that new verts will be added from in next section
-            VertexBase = CollisionData->Vertices.Num();
+        const FSimpleMeshBVH* BVH = GetSectionBVH(SectionIndex);
+        FSimpleMeshBVHHit Hit;
+        if (BVH && BVH->Raycast(It->VertexBuffer, It->IndexBuffer, FVector3f(LocalStart), FVector3f(LocalDirection), BestDistance, Hit))
+        {
+            BestDistance = Hit.Distance;
+            BestHit = Hit;
+            BestSection = SectionIndex;
         }
     }
 
-    CollisionData->bFlipNormals = true;
-    CollisionData->bDeformableMesh = true;
-    CollisionData->bFastCook = true;
+    if (BestSection == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const FVector LocalLocation = LocalStart + LocalDirection * BestHit.Distance;
+    OutHit.Location = Transform.TransformPosition(LocalLocation);
+    OutHit.Normal = Transform.TransformVectorNoScale(FVector(BestHit.Normal)).GetSafeNormal();
+    OutHit.Distance = (OutHit.Location - Start).Size();
+    OutHit.SectionIndex = BestSection;
+    OutHit.TriangleIndex = BestHit.TriangleIndex;
     return true;
 }
 
-bool USimpleMeshComponent::ContainsPhysicsTriMeshData(bool InUseAllTriData) const
+bool USimpleMeshComponent::OverlapBoxSections(FVector Center, FVector Extent, TArray<FSimpleMeshTriangleRef>& OutTriangles, bool bVisibleOnly)
 {
-    for (const FSimpleMeshSection& Section : MeshSections)
+    OutTriangles.Reset();
+
+    // The box is aligned with the component, so only its center is transformed
+    const FTransform& Transform = GetComponentTransform();
+    const FVector LocalCenter = Transform.InverseTransformPosition(Center);
+    const FVector LocalExtent = Extent.GetAbs() / Transform.GetScale3D().GetAbs().ComponentMax(FVector(UE_SMALL_NUMBER));
+    const FBox LocalBox = FBox::BuildAABB(LocalCenter, LocalExtent);
+
+    TArray<int32> SectionTriangles;
+    for (auto It = MeshSections.CreateConstIterator(); It; ++It)
     {
-        if (Section.IndexBuffer.Num() >= 3 && Section.bEnableCollision)
+        const int32 SectionIndex = It.GetIndex();
+        if ((bVisibleOnly && !It->Visible) || !It->SectionLocalBox.Intersect(LocalBox))
         {
-            return true;
+            continue;
+        }
+
+        const FSimpleMeshBVH* BVH = GetSectionBVH(SectionIndex);
+        if (!BVH)
+        {
+            continue;
+        }
+
+        SectionTriangles.Reset();
+        BVH->OverlapBox(It->VertexBuffer, It->IndexBuffer, FBox3f(LocalBox), SectionTriangles);
+        for (int32 TriIdx : SectionTriangles)
+        {
+            OutTriangles.Emplace(SectionIndex, TriIdx);
         }
     }
 
-    return false;
+    return OutTriangles.Num() > 0;
 }
 
+void USimpleMeshComponent::FinishSectionDeform(int32 SectionIndex, const FBox3f& SectionBox, bool bUpdateCollision)
+{
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    if (Section.VertexBuffer.Num() == 0)
+    {
+        return;
+    }
+    Section.SectionLocalBox = SectionBox.IsValid ? FBox(SectionBox) : FBox(ForceInit);
+    UpdateLocalBounds(true);
+
+    // Only the position stream changed: patch the existing GPU buffer instead of recreating the proxy
+    MarkSectionPositionsDirty(SectionIndex, 0, Section.VertexBuffer.Num());
 
-void USimpleMeshComponent::SetSimpleMeshSection(int32 SectionIndex, const FSimpleMeshSection& Section)
+    // A supplied collision mesh does not follow the vertices, a decimated one is decimated again and cooked once ready
+    if (bUpdateCollision && Section.bEnableCollision && !Section.bCustomCollisionMesh && !RequestSectionCollisionMesh(SectionIndex))
+    {
+        UpdateCollision();
+    }
+}
+
+
+void USimpleMeshComponent::UpdateMeshSectionVertexRange(int32 SectionIndex, int32 FirstVertex, const TArray<FVector>& Positions, bool bUpdateCollision)
+{
+    FSimpleMeshVertexRange Range;
+    Range.FirstVertex = FirstVertex;
+    Range.NumVertices = Positions.Num();
+
+    UpdateMeshSectionVertexRanges(SectionIndex, { Range }, Positions, bUpdateCollision);
+}
+
+void USimpleMeshComponent::UpdateMeshSectionVertexRanges(int32 SectionIndex, const TArray<FSimpleMeshVertexRange>& Ranges, const TArray<FVector>& Positions, bool bUpdateCollision)
 {
-    // Ensure sections array is long enough
-    if (SectionIndex >= MeshSections.Num())
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_UpdateVertexRange);
+
+    if (!MeshSections.IsValidIndex(SectionIndex))
+    {
+        return;
+    }
+
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    const int32 NumVertices = Section.VertexBuffer.Num();
+    if (NumVertices == 0)
     {
-        MeshSections.SetNum(SectionIndex + 1, false);
+        UE_LOG(LogSimpleComponent, Warning, TEXT("UpdateMeshSectionVertexRanges: section %d has no CPU vertices (released or empty)."), SectionIndex);
+        return;
     }
 
-    MeshSections[SectionIndex] = Section;
+    // Validate everything first so a bad range never leaves the section half written
+    int32 NumPositions = 0;
+    for (const FSimpleMeshVertexRange& Range : Ranges)
+    {
+        if (Range.FirstVertex < 0 || Range.NumVertices < 0 || Range.FirstVertex + Range.NumVertices > NumVertices)
+        {
+            UE_LOG(LogSimpleComponent, Warning, TEXT("UpdateMeshSectionVertexRanges: range [%d, %d) is outside section %d (%d vertices)."),
+                Range.FirstVertex, Range.FirstVertex + Range.NumVertices, SectionIndex, NumVertices);
+            return;
+        }
+        NumPositions += Range.NumVertices;
+    }
 
-    UpdateLocalBounds(); // Update overall bounds
-    UpdateCollision(); // Mark collision as dirty
-    MarkRenderStateDirty(); // New section requires recreating scene proxy
+    if (NumPositions != Positions.Num())
+    {
+        UE_LOG(LogSimpleComponent, Warning, TEXT("UpdateMeshSectionVertexRanges: ranges cover %d vertices but %d positions were given."), NumPositions, Positions.Num());
+        return;
+    }
+
+    FBox OldBox(ForceInit);
+    FBox NewBox(ForceInit);
+    int32 PositionIdx = 0;
+    for (const FSimpleMeshVertexRange& Range : Ranges)
+    {
+        for (int32 VertIdx = Range.FirstVertex; VertIdx < Range.FirstVertex + Range.NumVertices; VertIdx++)
+        {
+            FVector3f& Position = Section.VertexBuffer[VertIdx].Position;
+            OldBox += FVector(Position);
+            Position = FVector3f(Positions[PositionIdx]);
+            NewBox += Positions[PositionIdx];
+            PositionIdx++;
+        }
+
+        MarkSectionPositionsDirty(SectionIndex, Range.FirstVertex, Range.NumVertices);
+    }
+
+    // If none of the overwritten vertices were on the section box, the box can only grow.
+    // Otherwise one of them may have been holding the box open and we have to rescan the section.
+    if (Section.SectionLocalBox.IsValid && OldBox.IsValid && Section.SectionLocalBox.IsInside(OldBox))
+    {
+        Section.SectionLocalBox += NewBox;
+    }
+    else
+    {
+        Section.SectionLocalBox = ComputeSectionBox(Section);
+    }
+    UpdateLocalBounds(true);
+
+    if (bUpdateCollision && Section.bEnableCollision && !Section.bCustomCollisionMesh && !RequestSectionCollisionMesh(SectionIndex))
+    {
+        UpdateCollision();
+    }
 }
 
+FBox USimpleMeshComponent::ComputeSectionBox(const FSimpleMeshSection& Section)
+{
+    const TArray<FDynamicMeshVertex>& Vertices = Section.VertexBuffer;
+    const int32 NumVertices = Vertices.Num();
+    const int32 NumBlocks = FMath::DivideAndRoundUp(NumVertices, DeformBlockSize);
 
-FSimpleMeshSection* USimpleMeshComponent::GetSimpleMeshSection(int32 SectionIndex)
+    TArray<FBox3f> BlockBoxes;
+    BlockBoxes.SetNumUninitialized(NumBlocks);
+
+    ParallelFor(NumBlocks, [&](int32 BlockIndex)
+    {
+        const int32 First = BlockIndex * DeformBlockSize;
+        const int32 Last = FMath::Min(First + DeformBlockSize, NumVertices);
+
+        FBox3f BlockBox(ForceInit);
+        for (int32 VertIdx = First; VertIdx < Last; VertIdx++)
+        {
+            BlockBox += Vertices[VertIdx].Position;
+        }
+        BlockBoxes[BlockIndex] = BlockBox;
+    });
+
+    FBox3f SectionBox(ForceInit);
+    for (const FBox3f& BlockBox : BlockBoxes)
+    {
+        SectionBox += BlockBox;
+    }
+
+    return SectionBox.IsValid ? FBox(SectionBox) : FBox(ForceInit);
+}
+
+void USimpleMeshComponent::MarkSectionPositionsDirty(int32 SectionIndex, int32 FirstVertex, int32 NumVertices)
 {
-    if (SectionIndex < MeshSections.Num())
+    if (NumVertices <= 0)
     {
-        return &MeshSections[SectionIndex];
+        return;
+    }
+
+    // Ranges are recorded even when the proxy is about to be rebuilt, generated normals still need to know what moved
+    FSimpleMeshSection& Section = MeshSections[SectionIndex];
+    FSimpleMeshVertexRange::AddMerged(Section.DirtyVertexRanges, FirstVertex, NumVertices, DirtyRangeMergeGap);
+    MarkSectionSnapshotStale(SectionIndex);
+    Section.bBVHNeedsRefit = Section.BVH.IsValid();
+    Section.PositionsHash = 0; // no longer the input they were hashed from
+
+    if (SceneProxy && !IsRenderStateDirty())
+    {
+        MarkRenderDynamicDataDirty();
     }
     else
     {
-        return nullptr;
+        MarkRenderStateDirty();
     }
 }
 
+void USimpleMeshComponent::FlushSectionNormals(FSimpleMeshSection& Section)
+{
+    if (Section.bGenerateNormals && !Section.DirtyVertexRanges.IsEmpty())
+    {
+        SimpleMeshNormals::UpdateSectionNormals(Section, Section.DirtyVertexRanges);
+    }
+}
 
-UBodySetup* USimpleMeshComponent::GetBodySetup()
+void FSimpleMeshVertexRange::AddMerged(TArray<FSimpleMeshVertexRange>& Ranges, int32 FirstVertex, int32 NumVertices, int32 MergeGap)
 {
-    CreateSimpleMeshBodySetup();
-    return SimpleMeshBodySetup;
+    if (NumVertices <= 0)
+    {
+        return;
+    }
+
+    // Keep the ranges sorted, and merge the new one with every range it overlaps or nearly touches
+    int32 NewFirst = FirstVertex;
+    int32 NewLast = FirstVertex + NumVertices;
+
+    int32 InsertIdx = 0;
+    while (InsertIdx < Ranges.Num() && Ranges[InsertIdx].FirstVertex + Ranges[InsertIdx].NumVertices + MergeGap < NewFirst)
+    {
+        InsertIdx++;
+    }
+
+    int32 MergeEnd = InsertIdx;
+    while (MergeEnd < Ranges.Num() && Ranges[MergeEnd].FirstVertex <= NewLast + MergeGap)
+    {
+        NewFirst = FMath::Min(NewFirst, Ranges[MergeEnd].FirstVertex);
+        NewLast = FMath::Max(NewLast, Ranges[MergeEnd].FirstVertex + Ranges[MergeEnd].NumVertices);
+        MergeEnd++;
+    }
+
+    FSimpleMeshVertexRange Merged;
+    Merged.FirstVertex = NewFirst;
+    Merged.NumVertices = NewLast - NewFirst;
+
+    Ranges.RemoveAt(InsertIdx, MergeEnd - InsertIdx, false);
+    Ranges.Insert(Merged, InsertIdx);
+}
+
+void USimpleMeshComponent::SendRenderDynamicData_Concurrent()
+{
+    Super::SendRenderDynamicData_Concurrent();
+
+    for (TSparseArray<FSimpleMeshSection>::TIterator It(MeshSections); It; ++It)
+    {
+        const int32 SectionIndex = It.GetIndex();
+        FSimpleMeshSection& Section = *It;
+        if (Section.DirtyVertexRanges.IsEmpty())
+        {
+            continue;
+        }
+
+        // May widen the ranges to the one ring around the moved vertices
+        FlushSectionNormals(Section);
+
+        if (SceneProxy)
+        {
+            // Pack only the dirty ranges, this is what ends up being copied to the GPU
+            TArray<FVector3f> PackedPositions;
+            TArray<FPackedNormal> PackedTangents;
+            for (const FSimpleMeshVertexRange& Range : Section.DirtyVertexRanges)
+            {
+                for (int32 VertIdx = Range.FirstVertex; VertIdx < Range.FirstVertex + Range.NumVertices; VertIdx++)
+                {
+                    const FDynamicMeshVertex& Vertex = Section.VertexBuffer[VertIdx];
+                    PackedPositions.Add(Vertex.Position);
+                    if (Section.bGenerateNormals)
+                    {
+                        PackedTangents.Add(Vertex.TangentX);
+                        PackedTangents.Add(Vertex.TangentZ);
+                    }
+                }
+            }
+
+            FSimpleMeshSceneProxy* SimpleProxy = static_cast<FSimpleMeshSceneProxy*>(SceneProxy);
+            ENQUEUE_RENDER_COMMAND(FSimpleMeshSectionPositionsUpdate)(
+                [SimpleProxy, SectionIndex, Ranges = MoveTemp(Section.DirtyVertexRanges), PackedPositions = MoveTemp(PackedPositions), PackedTangents = MoveTemp(PackedTangents)](FRHICommandListImmediate& RHICmdList)
+                {
+                    int32 Offset = 0;
+                    for (const FSimpleMeshVertexRange& Range : Ranges)
+                    {
+                        SimpleProxy->UpdateSectionPositions_RenderThread(SectionIndex, Range.FirstVertex, TConstArrayView<FVector3f>(PackedPositions.GetData() + Offset, Range.NumVertices));
+                        if (PackedTangents.Num() > 0)
+                        {
+                            SimpleProxy->UpdateSectionTangents_RenderThread(SectionIndex, Range.FirstVertex, TConstArrayView<FPackedNormal>(PackedTangents.GetData() + Offset * 2, Range.NumVertices * 2));
+                        }
+                        Offset += Range.NumVertices;
+                    }
+                });
+        }
+
+        Section.DirtyVertexRanges.Reset();
+    }
 }
 
 
@@ -3,4 +3,277 @@
 // Licence: MIT License
 // Created by: BenjaCorp at iolaCorpStudio
 // Created at: 20/02/2024
-//---------SIMPLEMESHCOMPONENT---------//
\ No newline at end of file
+//---------SIMPLEMESHCOMPONENT---------//
+
+#include "SimpleMeshConversion.h"
+#include "SimpleMeshComponent.h"
+#include "SimpleMeshNormals.h"
+#include "MeshDescription.h"
+#include "StaticMeshAttributes.h"
+#include "Engine/StaticMesh.h"
+#include "PhysicsEngine/BodySetup.h"
+#include "Materials/Material.h"
+#include "Async/ParallelFor.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SimpleMeshConversion)
+
+DEFINE_LOG_CATEGORY_STATIC(LogSimpleMeshConversion, Log, All);
+
+DECLARE_CYCLE_STAT(TEXT("Build Mesh Description"), STAT_SimpleMesh_BuildMeshDescription, STATGROUP_SimpleMesh);
+
+namespace SimpleMeshConversion
+{
+    FName GetMaterialSlotName(int32 MaterialIndex)
+    {
+        return FName(*FString::Printf(TEXT("SimpleMeshSlot_%d"), MaterialIndex));
+    }
+
+    static int32 GetNumMaterialSlots(const USimpleMeshComponent* Component)
+    {
+        int32 NumSlots = FMath::Max(Component->GetNumMaterials(), Component->Materials.Num());
+        for (const FSimpleMeshSection& Section : Component->MeshSections)
+        {
+            NumSlots = FMath::Max(NumSlots, Section.MaterialIndex + 1);
+        }
+        return NumSlots;
+    }
+
+    /** Triangles that can be baked: complete, in range and not collapsed */
+    static bool IsValidTriangle(const FSimpleMeshSection& Section, int32 TriIdx)
+    {
+        const uint32 NumVerts = (uint32)Section.VertexBuffer.Num();
+        const uint32 I0 = Section.IndexBuffer[TriIdx * 3 + 0];
+        const uint32 I1 = Section.IndexBuffer[TriIdx * 3 + 1];
+        const uint32 I2 = Section.IndexBuffer[TriIdx * 3 + 2];
+        return I0 < NumVerts && I1 < NumVerts && I2 < NumVerts && I0 != I1 && I1 != I2 && I0 != I2;
+    }
+
+    bool BuildMeshDescription(const USimpleMeshComponent* Component, FMeshDescription& OutMeshDescription)
+    {
+        SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_BuildMeshDescription);
+
+        check(Component);
+
+        OutMeshDescription.Empty();
+        FStaticMeshAttributes Attributes(OutMeshDescription);
+        Attributes.Register();
+
+        // One polygon group per material slot, even unused ones, so slot indices match the component
+        const int32 NumSlots = FMath::Max(GetNumMaterialSlots(Component), 1);
+        TPolygonGroupAttributesRef<FName> SlotNames = Attributes.GetPolygonGroupMaterialSlotNames();
+        TArray<FPolygonGroupID> PolygonGroups;
+        for (int32 SlotIdx = 0; SlotIdx < NumSlots; SlotIdx++)
+        {
+            const FPolygonGroupID GroupID = OutMeshDescription.CreatePolygonGroup();
+            SlotNames[GroupID] = GetMaterialSlotName(SlotIdx);
+            PolygonGroups.Add(GroupID);
+        }
+
+        // Elements are created serially (the description is not thread safe), each section gets a contiguous block of IDs
+        TArray<const FSimpleMeshSection*> Sections;
+
+        // Released and evicted sections are baked from what they kept, reserved so the pointers stay valid
+        TArray<FSimpleMeshSection> RebuiltSections;
+        RebuiltSections.Reserve(Component->MeshSections.Num());
+        for (TSparseArray<FSimpleMeshSection>::TConstIterator It(Component->MeshSections); It; ++It)
+        {
+            if (!It->Visible || It->VertexBuffer.Num() > 0 || (!It->bGeometryReleased && It->CompressedVertices.Num() == 0))
+            {
+                Sections.Add(&*It);
+                continue;
+            }
+
+            // Released vertices come back with default tangents, generate them below
+            FSimpleMeshSection& Rebuilt = RebuiltSections.AddDefaulted_GetRef();
+            Rebuilt.MaterialIndex = It->MaterialIndex;
+            Rebuilt.bGenerateNormals = It->bGenerateNormals && !It->bGeometryReleased;
+            if (!It->GetCPUGeometry(Rebuilt.VertexBuffer, Rebuilt.IndexBuffer))
+            {
+                UE_LOG(LogSimpleMeshConversion, Error, TEXT("%s: section %d released its CPU geometry, it cannot be baked. Use KeepPositions or KeepAll retention."), *Component->GetName(), It.GetIndex());
+                return false;
+            }
+            Sections.Add(&Rebuilt);
+        }
+
+        TArray<int32> FirstVertex;
+        FirstVertex.SetNumZeroed(Sections.Num());
+        int32 NumVertices = 0;
+        int32 NumTriangles = 0;
+        for (int32 SectionIdx = 0; SectionIdx < Sections.Num(); SectionIdx++)
+        {
+            const FSimpleMeshSection& Section = *Sections[SectionIdx];
+            if (Section.Visible)
+            {
+                FirstVertex[SectionIdx] = NumVertices;
+                NumVertices += Section.VertexBuffer.Num();
+                NumTriangles += Section.IndexBuffer.Num() / 3;
+            }
+        }
+
+        if (NumTriangles == 0)
+        {
+            return false;
+        }
+
+        OutMeshDescription.ReserveNewVertices(NumVertices);
+        OutMeshDescription.ReserveNewVertexInstances(NumVertices);
+        OutMeshDescription.ReserveNewTriangles(NumTriangles);
+        OutMeshDescription.ReserveNewPolygons(NumTriangles);
+        OutMeshDescription.ReserveNewEdges(NumTriangles * 3);
+
+        for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+        {
+            const FVertexID VertexID = OutMeshDescription.CreateVertex();
+            const FVertexInstanceID InstanceID = OutMeshDescription.CreateVertexInstance(VertexID);
+            check(VertexID.GetValue() == VertIdx && InstanceID.GetValue() == VertIdx);
+        }
+
+        // Attributes are per element, sections can write theirs side by side
+        TVertexAttributesRef<FVector3f> Positions = Attributes.GetVertexPositions();
+        TVertexInstanceAttributesRef<FVector3f> Normals = Attributes.GetVertexInstanceNormals();
+        TVertexInstanceAttributesRef<FVector3f> Tangents = Attributes.GetVertexInstanceTangents();
+        TVertexInstanceAttributesRef<float> BinormalSigns = Attributes.GetVertexInstanceBinormalSigns();
+        TVertexInstanceAttributesRef<FVector4f> Colors = Attributes.GetVertexInstanceColors();
+        TVertexInstanceAttributesRef<FVector2f> UVs = Attributes.GetVertexInstanceUVs();
+
+        ParallelFor(Sections.Num(), [&](int32 SectionIdx)
+        {
+            const FSimpleMeshSection& Section = *Sections[SectionIdx];
+            if (!Section.Visible || Section.VertexBuffer.Num() == 0)
+            {
+                return;
+            }
+
+            // Lit static meshes need real normals
+            FSimpleMeshSection WithNormals;
+            const TArray<FDynamicMeshVertex>* Vertices = &Section.VertexBuffer;
+            if (!Section.bGenerateNormals)
+            {
+                WithNormals.VertexBuffer = Section.VertexBuffer;
+                WithNormals.IndexBuffer = Section.IndexBuffer;
+                SimpleMeshNormals::ComputeSectionNormals(WithNormals);
+                Vertices = &WithNormals.VertexBuffer;
+            }
+
+            const int32 Base = FirstVertex[SectionIdx];
+            for (int32 VertIdx = 0; VertIdx < Vertices->Num(); VertIdx++)
+            {
+                const FDynamicMeshVertex& Vertex = (*Vertices)[VertIdx];
+                const FVertexID VertexID(Base + VertIdx);
+                const FVertexInstanceID InstanceID(Base + VertIdx);
+
+                Positions[VertexID] = Vertex.Position;
+                Normals[InstanceID] = Vertex.TangentZ.ToFVector3f();
+                Tangents[InstanceID] = Vertex.TangentX.ToFVector3f();
+                BinormalSigns[InstanceID] = Vertex.TangentZ.Vector.W < 0 ? -1.f : 1.f;
+                Colors[InstanceID] = FVector4f(FLinearColor(Vertex.Color));
+                UVs[InstanceID] = Vertex.TextureCoordinate[0];
+            }
+        });
+
+        int32 NumSkipped = 0;
+        for (int32 SectionIdx = 0; SectionIdx < Sections.Num(); SectionIdx++)
+        {
+            const FSimpleMeshSection& Section = *Sections[SectionIdx];
+            if (!Section.Visible)
+            {
+                continue;
+            }
+
+            const FPolygonGroupID GroupID = PolygonGroups[FMath::Clamp(Section.MaterialIndex, 0, NumSlots - 1)];
+            const int32 Base = FirstVertex[SectionIdx];
+            for (int32 TriIdx = 0; TriIdx < Section.IndexBuffer.Num() / 3; TriIdx++)
+            {
+                if (!IsValidTriangle(Section, TriIdx))
+                {
+                    NumSkipped++;
+                    continue;
+                }
+
+                const FVertexInstanceID Corners[3] =
+                {
+                    FVertexInstanceID(Base + (int32)Section.IndexBuffer[TriIdx * 3 + 0]),
+                    FVertexInstanceID(Base + (int32)Section.IndexBuffer[TriIdx * 3 + 1]),
+                    FVertexInstanceID(Base + (int32)Section.IndexBuffer[TriIdx * 3 + 2])
+                };
+                OutMeshDescription.CreateTriangle(GroupID, Corners);
+            }
+        }
+
+        if (NumSkipped > 0)
+        {
+            UE_LOG(LogSimpleMeshConversion, Warning, TEXT("%s: skipped %d degenerate or out of range triangles"), *Component->GetName(), NumSkipped);
+        }
+
+        return OutMeshDescription.Triangles().Num() > 0;
+    }
+
+    void GetStaticMaterials(const USimpleMeshComponent* Component, TArray<FStaticMaterial>& OutMaterials)
+    {
+        const int32 NumSlots = FMath::Max(GetNumMaterialSlots(Component), 1);
+        OutMaterials.Reset(NumSlots);
+        for (int32 SlotIdx = 0; SlotIdx < NumSlots; SlotIdx++)
+        {
+            UMaterialInterface* Material = Component->GetMaterial(SlotIdx);
+            if (Material == nullptr && Component->Materials.IsValidIndex(SlotIdx))
+            {
+                Material = Component->Materials[SlotIdx];
+            }
+            if (Material == nullptr)
+            {
+                Material = UMaterial::GetDefaultMaterial(MD_Surface);
+            }
+
+            const FName SlotName = GetMaterialSlotName(SlotIdx);
+            OutMaterials.Add(FStaticMaterial(Material, SlotName, SlotName));
+        }
+    }
+
+    void CopyCollision(USimpleMeshComponent* Component, UStaticMesh* StaticMesh)
+    {
+        const UBodySetup* SourceBodySetup = Component->GetBodySetup();
+        if (SourceBodySetup == nullptr)
+        {
+            return;
+        }
+
+        StaticMesh->CreateBodySetup();
+        UBodySetup* BodySetup = StaticMesh->GetBodySetup();
+        BodySetup->AggGeom.ConvexElems = SourceBodySetup->AggGeom.ConvexElems;
+        BodySetup->CollisionTraceFlag = SourceBodySetup->CollisionTraceFlag;
+        BodySetup->bDoubleSidedGeometry = SourceBodySetup->bDoubleSidedGeometry;
+        BodySetup->InvalidatePhysicsData();
+    }
+}
+
+UStaticMesh* USimpleMeshConversionLibrary::BakeToStaticMesh(USimpleMeshComponent* Component, UObject* Outer, bool bAllowCPUAccess)
+{
+    if (Component == nullptr)
+    {
+        return nullptr;
+    }
+
+    FMeshDescription MeshDescription;
+    if (!SimpleMeshConversion::BuildMeshDescription(Component, MeshDescription))
+    {
+        UE_LOG(LogSimpleMeshConversion, Warning, TEXT("BakeToStaticMesh: %s has no triangles to bake, or sections without CPU geometry"), *Component->GetName());
+        return nullptr;
+    }
+
+    UStaticMesh* StaticMesh = NewObject<UStaticMesh>(Outer ? Outer : GetTransientPackage(), NAME_None, RF_Transient);
+    SimpleMeshConversion::GetStaticMaterials(Component, StaticMesh->GetStaticMaterials());
+
+    UStaticMesh::FBuildMeshDescriptionsParams Params;
+    Params.bBuildSimpleCollision = false;
+    Params.bFastBuild = true;
+    Params.bAllowCpuAccess = bAllowCPUAccess;
+    StaticMesh->BuildFromMeshDescriptions({ &MeshDescription }, Params);
+
+    SimpleMeshConversion::CopyCollision(Component, StaticMesh);
+    if (UBodySetup* BodySetup = StaticMesh->GetBodySetup())
+    {
+        BodySetup->CreatePhysicsMeshes();
+    }
+
+    return StaticMesh;
+}
@@ -0,0 +1,279 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHCONVEXDECOMPOSITION---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHCONVEXDECOMPOSITION---------//
+
+#include "SimpleMeshConvexDecomposition.h"
+#include "SimpleMeshComponent.h"
+#include "Async/ParallelFor.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SimpleMeshConvexDecomposition)
+
+DECLARE_CYCLE_STAT(TEXT("Convex Decomposition"), STAT_SimpleMesh_ConvexDecomposition, STATGROUP_SimpleMesh);
+
+namespace SimpleMeshConvexDecomposition
+{
+    /** Normals of the 26-DOP used to bound each piece */
+    static const TArray<FVector3f>& GetDopDirections()
+    {
+        static const TArray<FVector3f> Directions = []()
+        {
+            TArray<FVector3f> Result;
+            for (int32 X = -1; X <= 1; X++)
+            {
+                for (int32 Y = -1; Y <= 1; Y++)
+                {
+                    for (int32 Z = -1; Z <= 1; Z++)
+                    {
+                        if (X != 0 || Y != 0 || Z != 0)
+                        {
+                            Result.Add(FVector3f((float)X, (float)Y, (float)Z).GetUnsafeNormal());
+                        }
+                    }
+                }
+            }
+            return Result;
+        }();
+        return Directions;
+    }
+
+    /** A set of triangles that will end up as one hull */
+    struct FPiece
+    {
+        TArray<int32> Triangles;
+        float Concavity = 0.f;
+    };
+
+    struct FContext
+    {
+        TConstArrayView<FVector3f> Positions;
+        TConstArrayView<uint32> Indices;
+        TArray<FVector3f> Centroids;
+
+        const FVector3f& Corner(int32 TriIdx, int32 Corner) const
+        {
+            return Positions[Indices[TriIdx * 3 + Corner]];
+        }
+    };
+
+    /** How far the surface of a piece sinks below the faces of its k-DOP */
+    static float ComputeConcavity(const FContext& Context, TConstArrayView<int32> Triangles)
+    {
+        const TArray<FVector3f>& Directions = GetDopDirections();
+
+        TArray<float, TInlineAllocator<26>> Support;
+        Support.Init(-UE_BIG_NUMBER, Directions.Num());
+        for (int32 TriIdx : Triangles)
+        {
+            for (int32 Corner = 0; Corner < 3; Corner++)
+            {
+                const FVector3f& Position = Context.Corner(TriIdx, Corner);
+                for (int32 Dir = 0; Dir < Directions.Num(); Dir++)
+                {
+                    Support[Dir] = FMath::Max(Support[Dir], Directions[Dir] | Position);
+                }
+            }
+        }
+
+        float Concavity = 0.f;
+        for (int32 TriIdx : Triangles)
+        {
+            const FVector3f& Centroid = Context.Centroids[TriIdx];
+            float Depth = UE_BIG_NUMBER;
+            for (int32 Dir = 0; Dir < Directions.Num(); Dir++)
+            {
+                Depth = FMath::Min(Depth, Support[Dir] - (Directions[Dir] | Centroid));
+            }
+            Concavity = FMath::Max(Concavity, Depth);
+        }
+        return Concavity;
+    }
+
+    /** Split a piece in two at the median of its triangles along Axis */
+    static void SplitPiece(const FContext& Context, const FPiece& Piece, int32 Axis, FPiece& OutA, FPiece& OutB)
+    {
+        TArray<int32> Sorted = Piece.Triangles;
+        Sorted.Sort([&Context, Axis](int32 A, int32 B)
+        {
+            return Context.Centroids[A][Axis] < Context.Centroids[B][Axis];
+        });
+
+        const int32 Half = Sorted.Num() / 2;
+        OutA.Triangles = TArray<int32>(Sorted.GetData(), Half);
+        OutB.Triangles = TArray<int32>(Sorted.GetData() + Half, Sorted.Num() - Half);
+        OutA.Concavity = ComputeConcavity(Context, OutA.Triangles);
+        OutB.Concavity = ComputeConcavity(Context, OutB.Triangles);
+    }
+
+    /** Reduce a piece to at most MaxVertices hull points, thickening it if it is flat */
+    static void BuildHullPoints(const FContext& Context, const FPiece& Piece, const FSimpleMeshConvexDecompositionSettings& Settings, TArray<FVector>& OutPoints)
+    {
+        // Unique vertices and the average facing of the piece
+        TSet<uint32> UniqueVertices;
+        FVector3f Facing = FVector3f::ZeroVector;
+        for (int32 TriIdx : Piece.Triangles)
+        {
+            const FVector3f& P0 = Context.Corner(TriIdx, 0);
+            const FVector3f& P1 = Context.Corner(TriIdx, 1);
+            const FVector3f& P2 = Context.Corner(TriIdx, 2);
+            Facing += (P1 - P2) ^ (P0 - P2);
+
+            for (int32 Corner = 0; Corner < 3; Corner++)
+            {
+                UniqueVertices.Add(Context.Indices[TriIdx * 3 + Corner]);
+            }
+        }
+        Facing = Facing.GetSafeNormal();
+
+        FBox3f Box(ForceInit);
+        for (uint32 VertIdx : UniqueVertices)
+        {
+            Box += Context.Positions[VertIdx];
+        }
+        if (Facing.IsNearlyZero())
+        {
+            const FVector3f Extent = Box.GetExtent();
+            Facing = Extent.X <= Extent.Y && Extent.X <= Extent.Z ? FVector3f::ForwardVector : (Extent.Y <= Extent.Z ? FVector3f::RightVector : FVector3f::UpVector);
+        }
+
+        float MinDepth = UE_BIG_NUMBER;
+        float MaxDepth = -UE_BIG_NUMBER;
+        for (uint32 VertIdx : UniqueVertices)
+        {
+            const float Depth = Facing | Context.Positions[VertIdx];
+            MinDepth = FMath::Min(MinDepth, Depth);
+            MaxDepth = FMath::Max(MaxDepth, Depth);
+        }
+        const bool bFlat = MaxDepth - MinDepth < Settings.MinHullThickness;
+
+        // Extreme points along evenly spread directions are the ones that shape the hull
+        const int32 NumDirections = FMath::Max(bFlat ? Settings.MaxHullVertices / 2 : Settings.MaxHullVertices, 3);
+        TArray<uint32, TInlineAllocator<256>> SupportVertices;
+        for (int32 Dir = 0; Dir < NumDirections; Dir++)
+        {
+            const float Y = 1.f - (Dir + 0.5f) * 2.f / NumDirections;
+            const float Radius = FMath::Sqrt(FMath::Max(0.f, 1.f - Y * Y));
+            const float Phi = Dir * UE_PI * (3.f - FMath::Sqrt(5.f));
+            const FVector3f Direction(FMath::Cos(Phi) * Radius, Y, FMath::Sin(Phi) * Radius);
+
+            uint32 BestVertex = 0;
+            float BestDot = -UE_BIG_NUMBER;
+            for (uint32 VertIdx : UniqueVertices)
+            {
+                const float Dot = Direction | Context.Positions[VertIdx];
+                if (Dot > BestDot)
+                {
+                    BestDot = Dot;
+                    BestVertex = VertIdx;
+                }
+            }
+            SupportVertices.AddUnique(BestVertex);
+        }
+
+        OutPoints.Reset(SupportVertices.Num() * (bFlat ? 2 : 1));
+        for (uint32 VertIdx : SupportVertices)
+        {
+            OutPoints.Add(FVector(Context.Positions[VertIdx]));
+        }
+
+        // Flat pieces get a back side, behind the surface they face away from
+        if (bFlat)
+        {
+            const FVector Offset = FVector(Facing) * -(Settings.MinHullThickness - (MaxDepth - MinDepth));
+            const int32 NumFront = OutPoints.Num();
+            for (int32 PointIdx = 0; PointIdx < NumFront; PointIdx++)
+            {
+                OutPoints.Add(OutPoints[PointIdx] + Offset);
+            }
+        }
+    }
+
+    void Decompose(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices, const FSimpleMeshConvexDecompositionSettings& Settings, TArray<TArray<FVector>>& OutHulls)
+    {
+        SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_ConvexDecomposition);
+
+        OutHulls.Reset();
+
+        FContext Context;
+        Context.Positions = Positions;
+        Context.Indices = Indices;
+
+        const int32 NumTriangles = Indices.Num() / 3;
+        Context.Centroids.SetNumUninitialized(NumTriangles);
+
+        FPiece Root;
+        Root.Triangles.Reserve(NumTriangles);
+        for (int32 TriIdx = 0; TriIdx < NumTriangles; TriIdx++)
+        {
+            // Skip anything pointing outside the vertex buffer
+            if (Indices[TriIdx * 3 + 0] < (uint32)Positions.Num() && Indices[TriIdx * 3 + 1] < (uint32)Positions.Num() && Indices[TriIdx * 3 + 2] < (uint32)Positions.Num())
+            {
+                Root.Triangles.Add(TriIdx);
+            }
+        }
+
+        if (Root.Triangles.Num() == 0)
+        {
+            return;
+        }
+
+        ParallelFor(Root.Triangles.Num(), [&](int32 Idx)
+        {
+            const int32 TriIdx = Root.Triangles[Idx];
+            Context.Centroids[TriIdx] = (Context.Corner(TriIdx, 0) + Context.Corner(TriIdx, 1) + Context.Corner(TriIdx, 2)) / 3.f;
+        });
+        Root.Concavity = ComputeConcavity(Context, Root.Triangles);
+
+        TArray<FPiece> Pieces;
+        Pieces.Add(MoveTemp(Root));
+
+        while (Pieces.Num() < Settings.MaxHullCount)
+        {
+            // Most concave piece first
+            int32 Worst = INDEX_NONE;
+            for (int32 PieceIdx = 0; PieceIdx < Pieces.Num(); PieceIdx++)
+            {
+                if (Pieces[PieceIdx].Triangles.Num() >= 2 && Pieces[PieceIdx].Concavity > Settings.ConcavityTolerance
+                    && (Worst == INDEX_NONE || Pieces[PieceIdx].Concavity > Pieces[Worst].Concavity))
+                {
+                    Worst = PieceIdx;
+                }
+            }
+
+            if (Worst == INDEX_NONE)
+            {
+                break;
+            }
+
+            // Try the three axis planes at once and keep the one that leaves the least concavity behind
+            FPiece Candidates[3][2];
+            ParallelFor(3, [&](int32 Axis)
+            {
+                SplitPiece(Context, Pieces[Worst], Axis, Candidates[Axis][0], Candidates[Axis][1]);
+            });
+
+            int32 BestAxis = 0;
+            for (int32 Axis = 1; Axis < 3; Axis++)
+            {
+                if (FMath::Max(Candidates[Axis][0].Concavity, Candidates[Axis][1].Concavity) < FMath::Max(Candidates[BestAxis][0].Concavity, Candidates[BestAxis][1].Concavity))
+                {
+                    BestAxis = Axis;
+                }
+            }
+
+            Pieces[Worst] = MoveTemp(Candidates[BestAxis][0]);
+            Pieces.Add(MoveTemp(Candidates[BestAxis][1]));
+        }
+
+        OutHulls.SetNum(Pieces.Num());
+        ParallelFor(Pieces.Num(), [&](int32 PieceIdx)
+        {
+            BuildHullPoints(Context, Pieces[PieceIdx], Settings, OutHulls[PieceIdx]);
+        });
+
+        // A hull needs a volume
+        OutHulls.RemoveAll([](const TArray<FVector>& Hull) { return Hull.Num() < 4; });
+    }
+}
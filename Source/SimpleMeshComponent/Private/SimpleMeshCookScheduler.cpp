@@ -0,0 +1,214 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHCOOKSCHEDULER---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHCOOKSCHEDULER---------//
+
+#include "SimpleMeshCookScheduler.h"
+#include "SimpleMeshComponent.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "HAL/IConsoleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSimpleMeshCookScheduler, Log, All);
+
+DECLARE_CYCLE_STAT(TEXT("Cook Scheduler Tick"), STAT_SimpleMesh_CookSchedulerTick, STATGROUP_SimpleMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Collision Cooks Requested"), STAT_SimpleMesh_CooksRequested, STATGROUP_SimpleMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Collision Cooks Executed"), STAT_SimpleMesh_CooksExecuted, STATGROUP_SimpleMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Collision Cooks Aborted"), STAT_SimpleMesh_CooksAborted, STATGROUP_SimpleMesh);
+
+static float GSimpleMeshCookDebounceTime = 0.1f;
+static FAutoConsoleVariableRef CVarSimpleMeshCookDebounceTime(
+    TEXT("SimpleMesh.Cook.DebounceTime"),
+    GSimpleMeshCookDebounceTime,
+    TEXT("Seconds a SimpleMesh component must go without a new collision update before it is cooked."));
+
+static float GSimpleMeshCookMaxDelay = 0.5f;
+static FAutoConsoleVariableRef CVarSimpleMeshCookMaxDelay(
+    TEXT("SimpleMesh.Cook.MaxDelay"),
+    GSimpleMeshCookMaxDelay,
+    TEXT("Longest a SimpleMesh collision request waits for the debounce, for components updated every frame."));
+
+static int32 GSimpleMeshCookMaxConcurrent = 4;
+static FAutoConsoleVariableRef CVarSimpleMeshCookMaxConcurrent(
+    TEXT("SimpleMesh.Cook.MaxConcurrent"),
+    GSimpleMeshCookMaxConcurrent,
+    TEXT("Async SimpleMesh collision cooks running at once. 0 means no limit."));
+
+static FAutoConsoleCommand CmdSimpleMeshCookStats(
+    TEXT("SimpleMesh.Cook.Stats"),
+    TEXT("Print the collision cooks requested, executed and aborted by the SimpleMesh cook scheduler."),
+    FConsoleCommandDelegate::CreateLambda([]()
+    {
+        const FSimpleMeshCookScheduler& Scheduler = FSimpleMeshCookScheduler::Get();
+        const FSimpleMeshCookSchedulerStats& Stats = Scheduler.GetStats();
+        UE_LOG(LogSimpleMeshCookScheduler, Display, TEXT("Requested: %d, executed: %d, aborted: %d, pending: %d, in flight: %d"),
+            Stats.Requested, Stats.Executed, Stats.Aborted, Scheduler.GetNumPending(), Scheduler.GetNumInFlight());
+    }));
+
+/** Squared distance from the component to the closest player view of its world, 0 without players */
+static double GetDistanceSqToViewers(const USimpleMeshComponent* Component, TMap<const UWorld*, TArray<FVector>>& ViewLocations)
+{
+    const UWorld* World = Component->GetWorld();
+    TArray<FVector>* Locations = ViewLocations.Find(World);
+    if (!Locations)
+    {
+        Locations = &ViewLocations.Add(World);
+        if (World)
+        {
+            for (FConstPlayerControllerIterator It = World->GetPlayerControllerIterator(); It; ++It)
+            {
+                if (const APlayerController* PlayerController = It->Get())
+                {
+                    FVector Location;
+                    FRotator Rotation;
+                    PlayerController->GetPlayerViewPoint(Location, Rotation);
+                    Locations->Add(Location);
+                }
+            }
+        }
+    }
+
+    if (Locations->Num() == 0)
+    {
+        return 0.0;
+    }
+
+    double ClosestDistSq = MAX_dbl;
+    for (const FVector& Location : *Locations)
+    {
+        ClosestDistSq = FMath::Min(ClosestDistSq, FVector::DistSquared(Location, Component->Bounds.Origin));
+    }
+    return ClosestDistSq;
+}
+
+FSimpleMeshCookScheduler& FSimpleMeshCookScheduler::Get()
+{
+    static FSimpleMeshCookScheduler Instance;
+    return Instance;
+}
+
+void FSimpleMeshCookScheduler::RequestCook(USimpleMeshComponent* Component)
+{
+    check(IsInGameThread());
+
+    const double Now = FPlatformTime::Seconds();
+    FPendingCook* Request = Pending.Find(Component);
+    if (!Request)
+    {
+        Request = &Pending.Add(Component);
+        Request->FirstRequestTime = Now;
+    }
+    Request->LastRequestTime = Now;
+
+    Stats.Requested++;
+    INC_DWORD_STAT(STAT_SimpleMesh_CooksRequested);
+
+    if (!TickHandle.IsValid())
+    {
+        TickHandle = FTSTicker::GetCoreTicker().AddTicker(TEXT("SimpleMeshCookScheduler"), 0.f, [this](float DeltaTime)
+        {
+            return Tick(DeltaTime);
+        });
+    }
+}
+
+void FSimpleMeshCookScheduler::CancelCook(USimpleMeshComponent* Component)
+{
+    Pending.Remove(Component);
+    if (InFlight.Remove(Component) > 0)
+    {
+        Stats.Aborted++;
+        INC_DWORD_STAT(STAT_SimpleMesh_CooksAborted);
+    }
+}
+
+void FSimpleMeshCookScheduler::NotifyCookFinished(USimpleMeshComponent* Component, bool bSuccess)
+{
+    // Cooks dropped by CancelCook were already counted
+    if (InFlight.Remove(Component) > 0 && !bSuccess)
+    {
+        Stats.Aborted++;
+        INC_DWORD_STAT(STAT_SimpleMesh_CooksAborted);
+    }
+}
+
+bool FSimpleMeshCookScheduler::Tick(float DeltaTime)
+{
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_CookSchedulerTick);
+
+    // Components destroyed while waiting or cooking
+    for (auto It = Pending.CreateIterator(); It; ++It)
+    {
+        if (!It.Key().IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+    for (auto It = InFlight.CreateIterator(); It; ++It)
+    {
+        if (!It->IsValid())
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    const int32 NumFree = GSimpleMeshCookMaxConcurrent > 0 ? GSimpleMeshCookMaxConcurrent - InFlight.Num() : MAX_int32;
+    if (NumFree > 0 && Pending.Num() > 0)
+    {
+        struct FReadyCook
+        {
+            USimpleMeshComponent* Component;
+            double DistSq;
+        };
+
+        const double Now = FPlatformTime::Seconds();
+        TMap<const UWorld*, TArray<FVector>> ViewLocations;
+        TArray<FReadyCook> Ready;
+        for (const TPair<TWeakObjectPtr<USimpleMeshComponent>, FPendingCook>& Pair : Pending)
+        {
+            // One cook per component: a request made during a cook waits for it, and then covers every change since
+            if (InFlight.Contains(Pair.Key))
+            {
+                continue;
+            }
+
+            const FPendingCook& Request = Pair.Value;
+            if (Now - Request.LastRequestTime < GSimpleMeshCookDebounceTime && Now - Request.FirstRequestTime < GSimpleMeshCookMaxDelay)
+            {
+                continue;
+            }
+
+            USimpleMeshComponent* Component = Pair.Key.Get();
+            Ready.Add({ Component, GetDistanceSqToViewers(Component, ViewLocations) });
+        }
+
+        Ready.Sort([](const FReadyCook& A, const FReadyCook& B) { return A.DistSq < B.DistSq; });
+
+        const int32 NumToStart = FMath::Min(NumFree, Ready.Num());
+        for (int32 ReadyIdx = 0; ReadyIdx < NumToStart; ReadyIdx++)
+        {
+            USimpleMeshComponent* Component = Ready[ReadyIdx].Component;
+            Pending.Remove(Component);
+            if (!Component->IsRegistered())
+            {
+                continue;
+            }
+
+            InFlight.Add(Component);
+            Stats.Executed++;
+            INC_DWORD_STAT(STAT_SimpleMesh_CooksExecuted);
+
+            // May finish right away when the collision cache has the result
+            Component->StartAsyncCollisionCook();
+        }
+    }
+
+    if (Pending.Num() == 0)
+    {
+        TickHandle.Reset();
+        return false;
+    }
+    return true;
+}
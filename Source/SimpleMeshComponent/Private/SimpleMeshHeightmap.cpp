@@ -0,0 +1,328 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHHEIGHTMAP---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHHEIGHTMAP---------//
+
+#include "SimpleMeshHeightmap.h"
+#include "SimpleMeshComponent.h"
+#include "DynamicMeshBuilder.h"
+#include "Async/MappedFileHandle.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Hash/xxhash.h"
+#include "IImageWrapper.h"
+#include "IImageWrapperModule.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Guid.h"
+#include "Misc/Paths.h"
+#include "Misc/ScopeExit.h"
+#include "Misc/ScopeLock.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSimpleMeshHeightmap, Log, All);
+
+DECLARE_CYCLE_STAT(TEXT("Heightmap Tile Build"), STAT_SimpleMesh_HeightmapTileBuild, STATGROUP_SimpleMesh);
+DECLARE_CYCLE_STAT(TEXT("Heightmap PNG Decode"), STAT_SimpleMesh_HeightmapDecode, STATGROUP_SimpleMesh);
+
+namespace SimpleMeshHeightmapPrivate
+{
+    static constexpr uint32 CacheMagic = 0x4D484D53; // "SMHM"
+    static constexpr uint32 CacheVersion = 1;
+
+    /** Magic, version, width, height */
+    static constexpr int64 CacheHeaderSize = 16;
+
+    /** Cache of a PNG, named after its path, size and date so an edited PNG is decoded again */
+    static FString GetCacheFilename(const FString& Filename)
+    {
+        const FString FullPath = FPaths::ConvertRelativePathToFull(Filename);
+        const int64 FileSize = IFileManager::Get().FileSize(*FullPath);
+        const int64 TimeStamp = IFileManager::Get().GetTimeStamp(*FullPath).GetTicks();
+
+        FXxHash64Builder Builder;
+        Builder.Update(*FullPath, FullPath.Len() * sizeof(TCHAR));
+        Builder.Update(&FileSize, sizeof(FileSize));
+        Builder.Update(&TimeStamp, sizeof(TimeStamp));
+        return FPaths::ProjectSavedDir() / TEXT("SimpleMeshHeightmapCache") / FString::Printf(TEXT("%016llx.r16"), Builder.Finalize().Hash);
+    }
+
+    static bool ReadCacheHeader(const FString& CacheFilename, int32& OutWidth, int32& OutHeight)
+    {
+        TUniquePtr<FArchive> Reader(IFileManager::Get().CreateFileReader(*CacheFilename, FILEREAD_Silent));
+        if (!Reader || Reader->TotalSize() < CacheHeaderSize)
+        {
+            return false;
+        }
+
+        uint32 Magic = 0;
+        uint32 Version = 0;
+        *Reader << Magic << Version << OutWidth << OutHeight;
+        return Magic == CacheMagic && Version == CacheVersion && OutWidth > 1 && OutHeight > 1
+            && Reader->TotalSize() == CacheHeaderSize + (int64)OutWidth * OutHeight * sizeof(uint16);
+    }
+}
+
+using namespace SimpleMeshHeightmapPrivate;
+
+TSharedPtr<FSimpleMeshHeightmap, ESPMode::ThreadSafe> FSimpleMeshHeightmap::Open(const FString& Filename, int32 InWidth, int32 InHeight)
+{
+    if (FPaths::GetExtension(Filename).Equals(TEXT("png"), ESearchCase::IgnoreCase))
+    {
+        return OpenPNG(Filename);
+    }
+    return OpenRaw(Filename, InWidth, InHeight);
+}
+
+TSharedPtr<FSimpleMeshHeightmap, ESPMode::ThreadSafe> FSimpleMeshHeightmap::OpenRaw(const FString& Filename, int32 InWidth, int32 InHeight)
+{
+    const int64 NumPixels = IFileManager::Get().FileSize(*Filename) / (int64)sizeof(uint16);
+    if (NumPixels <= 0)
+    {
+        UE_LOG(LogSimpleMeshHeightmap, Warning, TEXT("Cannot read heightmap %s."), *Filename);
+        return nullptr;
+    }
+
+    if (InWidth <= 0)
+    {
+        InWidth = InHeight = (int32)FMath::Sqrt((double)NumPixels);
+    }
+    else if (InHeight <= 0)
+    {
+        InHeight = (int32)FMath::Min<int64>(NumPixels / InWidth, MAX_int32);
+    }
+
+    if ((int64)InWidth * InHeight > NumPixels)
+    {
+        UE_LOG(LogSimpleMeshHeightmap, Warning, TEXT("Heightmap %s holds %lld pixels, %d x %d requested."), *Filename, NumPixels, InWidth, InHeight);
+        return nullptr;
+    }
+
+    return OpenMapped(Filename, 0, InWidth, InHeight);
+}
+
+TSharedPtr<FSimpleMeshHeightmap, ESPMode::ThreadSafe> FSimpleMeshHeightmap::OpenPNG(const FString& Filename)
+{
+    const FString CacheFilename = GetCacheFilename(Filename);
+    int32 CacheWidth = 0;
+    int32 CacheHeight = 0;
+    if (ReadCacheHeader(CacheFilename, CacheWidth, CacheHeight))
+    {
+        return OpenMapped(CacheFilename, CacheHeaderSize, CacheWidth, CacheHeight);
+    }
+
+    IImageWrapperModule* ImageWrapperModule = FModuleManager::GetModulePtr<IImageWrapperModule>(TEXT("ImageWrapper"));
+    if (!ImageWrapperModule && IsInGameThread())
+    {
+        ImageWrapperModule = &FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+    }
+    if (!ImageWrapperModule)
+    {
+        UE_LOG(LogSimpleMeshHeightmap, Error, TEXT("Heightmap %s: the ImageWrapper module must be loaded on the game thread first."), *Filename);
+        return nullptr;
+    }
+
+    // The only time the whole image is in memory
+    {
+        SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_HeightmapDecode);
+
+        TArray64<uint8> Compressed;
+        if (!FFileHelper::LoadFileToArray(Compressed, *Filename, FILEREAD_Silent))
+        {
+            UE_LOG(LogSimpleMeshHeightmap, Warning, TEXT("Cannot read heightmap %s."), *Filename);
+            return nullptr;
+        }
+
+        TSharedPtr<IImageWrapper> ImageWrapper = ImageWrapperModule->CreateImageWrapper(EImageFormat::PNG);
+        TArray64<uint8> Pixels;
+        if (!ImageWrapper.IsValid() || !ImageWrapper->SetCompressed(Compressed.GetData(), Compressed.Num()) || !ImageWrapper->GetRaw(ERGBFormat::Gray, 16, Pixels))
+        {
+            UE_LOG(LogSimpleMeshHeightmap, Warning, TEXT("Heightmap %s is not a PNG that can be read as 16-bit gray."), *Filename);
+            return nullptr;
+        }
+        Compressed.Empty();
+
+        int32 ImageWidth = (int32)ImageWrapper->GetWidth();
+        int32 ImageHeight = (int32)ImageWrapper->GetHeight();
+
+        // Written next to its final name, then moved, so a cache is never read half written.
+        // Each decode has its own temp file: terrains opening the same PNG at once must not write into each other.
+        const FString TempFilename = FString::Printf(TEXT("%s.%s.tmp"), *CacheFilename, *FGuid::NewGuid().ToString());
+        {
+            TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*TempFilename));
+            if (!Writer)
+            {
+                UE_LOG(LogSimpleMeshHeightmap, Warning, TEXT("Cannot write the heightmap cache %s."), *TempFilename);
+                return nullptr;
+            }
+
+            uint32 Magic = CacheMagic;
+            uint32 Version = CacheVersion;
+            *Writer << Magic << Version << ImageWidth << ImageHeight;
+            Writer->Serialize(Pixels.GetData(), Pixels.Num());
+        }
+
+        if (!IFileManager::Get().Move(*CacheFilename, *TempFilename, true, true))
+        {
+            // Another decode of the same PNG got there first, its cache may already be mapped
+            IFileManager::Get().Delete(*TempFilename, false, false, true);
+            if (!ReadCacheHeader(CacheFilename, CacheWidth, CacheHeight))
+            {
+                UE_LOG(LogSimpleMeshHeightmap, Warning, TEXT("Cannot write the heightmap cache %s."), *CacheFilename);
+                return nullptr;
+            }
+        }
+
+        UE_LOG(LogSimpleMeshHeightmap, Log, TEXT("Heightmap %s (%d x %d) decoded into %s."), *Filename, ImageWidth, ImageHeight, *CacheFilename);
+    }
+
+    if (!ReadCacheHeader(CacheFilename, CacheWidth, CacheHeight))
+    {
+        return nullptr;
+    }
+    return OpenMapped(CacheFilename, CacheHeaderSize, CacheWidth, CacheHeight);
+}
+
+TSharedPtr<FSimpleMeshHeightmap, ESPMode::ThreadSafe> FSimpleMeshHeightmap::OpenMapped(const FString& Filename, int64 InDataOffset, int32 InWidth, int32 InHeight)
+{
+    if (InWidth < 2 || InHeight < 2)
+    {
+        UE_LOG(LogSimpleMeshHeightmap, Warning, TEXT("Heightmap %s is %d x %d, at least 2 x 2 is needed."), *Filename, InWidth, InHeight);
+        return nullptr;
+    }
+
+    IMappedFileHandle* MappedFile = FPlatformFileManager::Get().GetPlatformFile().OpenMapped(*Filename);
+    if (!MappedFile)
+    {
+        UE_LOG(LogSimpleMeshHeightmap, Warning, TEXT("Cannot map heightmap %s."), *Filename);
+        return nullptr;
+    }
+
+    TSharedPtr<FSimpleMeshHeightmap, ESPMode::ThreadSafe> Heightmap = MakeShareable(new FSimpleMeshHeightmap());
+    Heightmap->MappedFile.Reset(MappedFile);
+    Heightmap->DataOffset = InDataOffset;
+    Heightmap->Width = InWidth;
+    Heightmap->Height = InHeight;
+    return Heightmap;
+}
+
+FSimpleMeshHeightmap::~FSimpleMeshHeightmap()
+{
+    // Regions must go before their file, UnmapRows was called by every reader
+    MappedFile.Reset();
+}
+
+bool FSimpleMeshHeightmap::MapRows(int32 FirstRow, int32 NumRows, FSimpleMeshHeightmapRows& OutRows) const
+{
+    FirstRow = FMath::Clamp(FirstRow, 0, Height - 1);
+    NumRows = FMath::Clamp(NumRows, 1, Height - FirstRow);
+
+    const int64 RowBytes = (int64)Width * sizeof(uint16);
+    IMappedFileRegion* Region = nullptr;
+    {
+        FScopeLock Lock(&MappingLock);
+        Region = MappedFile->MapRegion(DataOffset + FirstRow * RowBytes, NumRows * RowBytes);
+    }
+    if (!Region)
+    {
+        return false;
+    }
+
+    OutRows.Region = Region;
+    OutRows.Data = reinterpret_cast<const uint16*>(Region->GetMappedPtr());
+    OutRows.FirstRow = FirstRow;
+    OutRows.NumRows = NumRows;
+    OutRows.Width = Width;
+    return true;
+}
+
+void FSimpleMeshHeightmap::UnmapRows(FSimpleMeshHeightmapRows& Rows) const
+{
+    {
+        FScopeLock Lock(&MappingLock);
+        delete Rows.Region;
+    }
+    Rows = FSimpleMeshHeightmapRows();
+}
+
+FIntPoint FSimpleMeshHeightmap::GetNumTiles(int32 NumQuads) const
+{
+    NumQuads = FMath::Max(NumQuads, 1);
+    return FIntPoint(FMath::DivideAndRoundUp(Width - 1, NumQuads), FMath::DivideAndRoundUp(Height - 1, NumQuads));
+}
+
+bool FSimpleMeshHeightmap::BuildTileSection(FIntPoint Tile, int32 NumQuads, const FVector& Scale, FSimpleMeshSection& OutSection) const
+{
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_HeightmapTileBuild);
+
+    NumQuads = FMath::Max(NumQuads, 1);
+    const int32 X0 = Tile.X * NumQuads;
+    const int32 Y0 = Tile.Y * NumQuads;
+    if (Tile.X < 0 || Tile.Y < 0 || X0 >= Width - 1 || Y0 >= Height - 1)
+    {
+        return false;
+    }
+
+    const int32 NumX = FMath::Min(NumQuads, Width - 1 - X0);
+    const int32 NumY = FMath::Min(NumQuads, Height - 1 - Y0);
+
+    // One more row on each side for the normals of the edge vertices
+    FSimpleMeshHeightmapRows Rows;
+    if (!MapRows(Y0 - 1, NumY + 3, Rows))
+    {
+        return false;
+    }
+    ON_SCOPE_EXIT
+    {
+        UnmapRows(Rows);
+    };
+
+    const float ZScale = (float)Scale.Z / 128.f;
+    auto GetHeight = [&Rows, ZScale](int32 X, int32 Y)
+    {
+        return ((float)Rows.Get(X, Y) - 32768.f) * ZScale;
+    };
+
+    const int32 RowSize = NumX + 1;
+    OutSection.Reset();
+    OutSection.VertexBuffer.SetNum(RowSize * (NumY + 1));
+    for (int32 Y = 0; Y <= NumY; Y++)
+    {
+        for (int32 X = 0; X <= NumX; X++)
+        {
+            const int32 PixelX = X0 + X;
+            const int32 PixelY = Y0 + Y;
+            const float SlopeX = (GetHeight(PixelX + 1, PixelY) - GetHeight(PixelX - 1, PixelY)) / (2.f * (float)Scale.X);
+            const float SlopeY = (GetHeight(PixelX, PixelY + 1) - GetHeight(PixelX, PixelY - 1)) / (2.f * (float)Scale.Y);
+            const FVector3f Normal = FVector3f(-SlopeX, -SlopeY, 1.f).GetSafeNormal();
+            const FVector3f TangentX = (FVector3f::ForwardVector - Normal * Normal.X).GetSafeNormal();
+
+            FDynamicMeshVertex& Vertex = OutSection.VertexBuffer[Y * RowSize + X];
+            Vertex.Position = FVector3f((float)(PixelX * Scale.X), (float)(PixelY * Scale.Y), GetHeight(PixelX, PixelY));
+            Vertex.TextureCoordinate[0] = FVector2f((float)PixelX / (Width - 1), (float)PixelY / (Height - 1));
+            Vertex.Color = FColor::White;
+            Vertex.SetTangents(TangentX, Normal ^ TangentX, Normal);
+            OutSection.SectionLocalBox += FVector(Vertex.Position);
+        }
+    }
+
+    // Same triangles as ASubdivisablePlane
+    OutSection.IndexBuffer.SetNumUninitialized(NumX * NumY * 6);
+    uint32* Indices = OutSection.IndexBuffer.GetData();
+    for (int32 Y = 0; Y < NumY; Y++)
+    {
+        for (int32 X = 0; X < NumX; X++)
+        {
+            const uint32 Index = X + RowSize * Y;
+            *Indices++ = Index;
+            *Indices++ = Index + RowSize;
+            *Indices++ = Index + 1;
+            *Indices++ = Index + 1;
+            *Indices++ = Index + RowSize;
+            *Indices++ = Index + RowSize + 1;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,276 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHHEIGHTMAPTERRAIN---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHHEIGHTMAPTERRAIN---------//
+
+#include "SimpleMeshHeightmapTerrain.h"
+#include "SimpleMeshHeightmap.h"
+#include "Async/Async.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+#include "IImageWrapperModule.h"
+#include "Misc/Paths.h"
+#include "Modules/ModuleManager.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSimpleMeshHeightmapTerrain, Log, All);
+
+DECLARE_DWORD_COUNTER_STAT(TEXT("Heightmap Tiles Loaded"), STAT_SimpleMesh_HeightmapTilesLoaded, STATGROUP_SimpleMesh);
+
+ASimpleMeshHeightmapTerrain::ASimpleMeshHeightmapTerrain()
+{
+    PrimaryActorTick.bCanEverTick = true;
+
+    SimpleMeshComponent = CreateDefaultSubobject<USimpleMeshComponent>(TEXT("SimpleMeshComponent"));
+    RootComponent = SimpleMeshComponent;
+    SimpleMeshComponent->SetMobility(EComponentMobility::Static);
+    SimpleMeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
+    SimpleMeshComponent->SetCollisionResponseToAllChannels(ECR_Block);
+
+    Material = nullptr;
+}
+
+void ASimpleMeshHeightmapTerrain::BeginPlay()
+{
+    Super::BeginPlay();
+    ReloadHeightmap();
+}
+
+void ASimpleMeshHeightmapTerrain::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    ResetTiles();
+    Super::EndPlay(EndPlayReason);
+}
+
+void ASimpleMeshHeightmapTerrain::ReloadHeightmap()
+{
+    ResetTiles();
+
+    if (HeightmapFile.FilePath.IsEmpty())
+    {
+        return;
+    }
+
+    const FString Filename = FPaths::IsRelative(HeightmapFile.FilePath)
+        ? FPaths::ConvertRelativePathToFull(FPaths::ProjectDir(), HeightmapFile.FilePath)
+        : HeightmapFile.FilePath;
+
+    // The first open of a PNG decodes it on the worker, the module has to be loaded here
+    if (FPaths::GetExtension(Filename).Equals(TEXT("png"), ESearchCase::IgnoreCase))
+    {
+        FModuleManager::LoadModuleChecked<IImageWrapperModule>(TEXT("ImageWrapper"));
+    }
+
+    Async(EAsyncExecution::ThreadPool, [WeakThis = TWeakObjectPtr<ASimpleMeshHeightmapTerrain>(this), Serial = StreamSerial, Filename, Width = RawWidth, Height = RawHeight]()
+    {
+        TSharedPtr<FSimpleMeshHeightmap, ESPMode::ThreadSafe> NewHeightmap = FSimpleMeshHeightmap::Open(Filename, Width, Height);
+
+        AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, NewHeightmap = MoveTemp(NewHeightmap)]()
+        {
+            if (ASimpleMeshHeightmapTerrain* Terrain = WeakThis.Get())
+            {
+                Terrain->FinishOpenHeightmap(Serial, NewHeightmap);
+            }
+        });
+    });
+}
+
+void ASimpleMeshHeightmapTerrain::FinishOpenHeightmap(uint32 Serial, TSharedPtr<FSimpleMeshHeightmap, ESPMode::ThreadSafe> NewHeightmap)
+{
+    if (Serial != StreamSerial)
+    {
+        return;
+    }
+
+    Heightmap = NewHeightmap;
+    if (Heightmap.IsValid())
+    {
+        const FIntPoint NumTiles = Heightmap->GetNumTiles(TileQuads);
+        UE_LOG(LogSimpleMeshHeightmapTerrain, Log, TEXT("%s: heightmap %d x %d, %d x %d tiles."), *GetName(), Heightmap->GetWidth(), Heightmap->GetHeight(), NumTiles.X, NumTiles.Y);
+    }
+}
+
+int32 ASimpleMeshHeightmapTerrain::GetNumLoadedTiles() const
+{
+    int32 NumLoaded = 0;
+    for (const TPair<FIntPoint, FHeightmapTile>& Tile : Tiles)
+    {
+        NumLoaded += Tile.Value.Component != nullptr ? 1 : 0;
+    }
+    return NumLoaded;
+}
+
+void ASimpleMeshHeightmapTerrain::ResetTiles()
+{
+    StreamSerial++;
+    Heightmap.Reset();
+    for (const TPair<FIntPoint, FHeightmapTile>& Tile : Tiles)
+    {
+        if (Tile.Value.Component)
+        {
+            ReleaseTileComponent(Tile.Value.Component);
+            DEC_DWORD_STAT(STAT_SimpleMesh_HeightmapTilesLoaded);
+        }
+    }
+    Tiles.Reset();
+    NumTilesBuilding = 0;
+}
+
+USimpleMeshComponent* ASimpleMeshHeightmapTerrain::AcquireTileComponent()
+{
+    USimpleMeshComponent* Component = nullptr;
+    if (TileComponentPool.Num() > 0)
+    {
+        Component = TileComponentPool.Pop(false);
+    }
+    else
+    {
+        Component = NewObject<USimpleMeshComponent>(this, NAME_None, RF_Transient);
+        Component->SetMobility(SimpleMeshComponent->Mobility);
+        Component->SetupAttachment(SimpleMeshComponent);
+        Component->SetCollisionObjectType(SimpleMeshComponent->GetCollisionObjectType());
+        Component->SetCollisionEnabled(SimpleMeshComponent->GetCollisionEnabled());
+        Component->SetCollisionResponseToChannels(SimpleMeshComponent->GetCollisionResponseToChannels());
+        Component->RegisterComponent();
+    }
+
+    TileComponents.Add(Component);
+    return Component;
+}
+
+void ASimpleMeshHeightmapTerrain::ReleaseTileComponent(USimpleMeshComponent* Component)
+{
+    // Its section keeps its memory for the next tile
+    Component->ClearAllMeshSections();
+    TileComponents.RemoveSingleSwap(Component);
+    TileComponentPool.Add(Component);
+}
+
+double ASimpleMeshHeightmapTerrain::GetTileDistance(const FVector& LocalLocation, const FIntPoint& Tile) const
+{
+    const FVector2D TileSize(TileQuads * HeightmapScale.X, TileQuads * HeightmapScale.Y);
+    const FBox2D TileBox(FVector2D(Tile) * TileSize, (FVector2D(Tile) + FVector2D(1.0, 1.0)) * TileSize);
+    return FMath::Sqrt(TileBox.ComputeSquaredDistanceToPoint(FVector2D(LocalLocation)));
+}
+
+bool ASimpleMeshHeightmapTerrain::GetLocalViewLocation(FVector& OutLocation) const
+{
+    const UWorld* World = GetWorld();
+    const APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+    if (!PlayerController)
+    {
+        return false;
+    }
+
+    FVector ViewLocation;
+    FRotator ViewRotation;
+    PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+    OutLocation = SimpleMeshComponent->GetComponentTransform().InverseTransformPosition(ViewLocation);
+    return true;
+}
+
+void ASimpleMeshHeightmapTerrain::Tick(float DeltaTime)
+{
+    Super::Tick(DeltaTime);
+
+    FVector ViewLocation;
+    if (!Heightmap.IsValid() || !GetLocalViewLocation(ViewLocation))
+    {
+        return;
+    }
+
+    // Out of range tiles go first, their builds in flight are dropped on arrival. Failed tiles are forgotten once their delay is over, to be queued again.
+    const double Now = GetWorld()->GetTimeSeconds();
+    for (auto It = Tiles.CreateIterator(); It; ++It)
+    {
+        const bool bRetry = It.Value().RetryTime > 0.0 && It.Value().RetryTime <= Now;
+        if (bRetry || GetTileDistance(ViewLocation, It.Key()) > FMath::Max(UnloadRadius, LoadRadius))
+        {
+            if (It.Value().Component)
+            {
+                ReleaseTileComponent(It.Value().Component);
+                DEC_DWORD_STAT(STAT_SimpleMesh_HeightmapTilesLoaded);
+            }
+            It.RemoveCurrent();
+        }
+    }
+
+    if (NumTilesBuilding >= MaxConcurrentTileBuilds)
+    {
+        return;
+    }
+
+    // Missing tiles in range, nearest first
+    const FIntPoint NumTiles = Heightmap->GetNumTiles(TileQuads);
+    const FVector2D TileSize(TileQuads * HeightmapScale.X, TileQuads * HeightmapScale.Y);
+    const FIntPoint MinTile(
+        FMath::Clamp(FMath::FloorToInt32((ViewLocation.X - LoadRadius) / TileSize.X), 0, NumTiles.X - 1),
+        FMath::Clamp(FMath::FloorToInt32((ViewLocation.Y - LoadRadius) / TileSize.Y), 0, NumTiles.Y - 1));
+    const FIntPoint MaxTile(
+        FMath::Clamp(FMath::FloorToInt32((ViewLocation.X + LoadRadius) / TileSize.X), 0, NumTiles.X - 1),
+        FMath::Clamp(FMath::FloorToInt32((ViewLocation.Y + LoadRadius) / TileSize.Y), 0, NumTiles.Y - 1));
+
+    TArray<TPair<double, FIntPoint>> Missing;
+    for (int32 TileY = MinTile.Y; TileY <= MaxTile.Y; TileY++)
+    {
+        for (int32 TileX = MinTile.X; TileX <= MaxTile.X; TileX++)
+        {
+            const FIntPoint Tile(TileX, TileY);
+            const double Distance = GetTileDistance(ViewLocation, Tile);
+            if (Distance <= LoadRadius && !Tiles.Contains(Tile))
+            {
+                Missing.Emplace(Distance, Tile);
+            }
+        }
+    }
+    Missing.Sort([](const TPair<double, FIntPoint>& A, const TPair<double, FIntPoint>& B) { return A.Key < B.Key; });
+
+    const int32 NumToStart = FMath::Min(Missing.Num(), MaxConcurrentTileBuilds - NumTilesBuilding);
+    for (int32 MissingIdx = 0; MissingIdx < NumToStart; MissingIdx++)
+    {
+        const FIntPoint Tile = Missing[MissingIdx].Value;
+        Tiles.Add(Tile);
+        NumTilesBuilding++;
+
+        Async(EAsyncExecution::ThreadPool, [WeakThis = TWeakObjectPtr<ASimpleMeshHeightmapTerrain>(this), Serial = StreamSerial, Source = Heightmap, Tile, NumQuads = TileQuads, Scale = HeightmapScale]()
+        {
+            FSimpleMeshSection Section;
+            const bool bBuilt = Source->BuildTileSection(Tile, NumQuads, Scale, Section);
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, Tile, bBuilt, Section = MoveTemp(Section)]() mutable
+            {
+                if (ASimpleMeshHeightmapTerrain* Terrain = WeakThis.Get())
+                {
+                    Terrain->FinishTile(Serial, Tile, bBuilt, MoveTemp(Section));
+                }
+            });
+        });
+    }
+}
+
+void ASimpleMeshHeightmapTerrain::FinishTile(uint32 Serial, FIntPoint Tile, bool bBuilt, FSimpleMeshSection&& Section)
+{
+    if (Serial != StreamSerial)
+    {
+        return;
+    }
+    NumTilesBuilding--;
+
+    FHeightmapTile* TileState = Tiles.Find(Tile);
+    if (!TileState || TileState->Component)
+    {
+        return;
+    }
+
+    if (!bBuilt)
+    {
+        UE_LOG(LogSimpleMeshHeightmapTerrain, Warning, TEXT("%s: tile (%d, %d) could not be read from the heightmap, retrying in %.1f s."), *GetName(), Tile.X, Tile.Y, TileRetryDelay);
+        TileState->RetryTime = GetWorld()->GetTimeSeconds() + FMath::Max(TileRetryDelay, UE_KINDA_SMALL_NUMBER);
+        return;
+    }
+
+    TileState->Component = AcquireTileComponent();
+    TileState->Component->CommitMeshSection(0, MoveTemp(Section), Material, true, bTileCollision);
+    INC_DWORD_STAT(STAT_SimpleMesh_HeightmapTilesLoaded);
+}
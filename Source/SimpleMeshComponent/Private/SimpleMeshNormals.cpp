@@ -0,0 +1,227 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHNORMALS---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHNORMALS---------//
+
+#include "SimpleMeshNormals.h"
+#include "SimpleMeshComponent.h"
+#include "Async/ParallelFor.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSimpleMeshNormals, Log, All);
+
+DECLARE_CYCLE_STAT(TEXT("Compute Section Normals"), STAT_SimpleMesh_ComputeNormals, STATGROUP_SimpleMesh);
+DECLARE_CYCLE_STAT(TEXT("Update Section Normals"), STAT_SimpleMesh_UpdateNormals, STATGROUP_SimpleMesh);
+
+/** Number of triangles or vertices processed by each worker */
+static constexpr int32 NormalsBlockSize = 1024;
+
+/** Checked once per section before generating, the per triangle and per vertex loops then index without bound checks */
+static bool AreIndicesInRange(const TArray<uint32>& Indices, int32 NumVertices)
+{
+    uint32 MaxIndex = 0;
+    for (const uint32 Index : Indices)
+    {
+        MaxIndex = FMath::Max(MaxIndex, Index);
+    }
+    return Indices.Num() == 0 || MaxIndex < (uint32)NumVertices;
+}
+
+static FVector3f ComputeFaceNormal(const TArray<FDynamicMeshVertex>& Vertices, const TArray<uint32>& Indices, int32 TriIdx)
+{
+    const FVector3f& P0 = Vertices[Indices[TriIdx * 3 + 0]].Position;
+    const FVector3f& P1 = Vertices[Indices[TriIdx * 3 + 1]].Position;
+    const FVector3f& P2 = Vertices[Indices[TriIdx * 3 + 2]].Position;
+
+    // Same winding as the engine mesh utilities, left unnormalized so bigger faces weigh more
+    return (P1 - P2) ^ (P0 - P2);
+}
+
+static void ComputeVertexTangents(FDynamicMeshVertex& Vertex, const FSimpleMeshVertexAdjacency& Adjacency, int32 VertIdx)
+{
+    FVector3f Sum = FVector3f::ZeroVector;
+    for (int32 Slot = Adjacency.Offsets[VertIdx]; Slot < Adjacency.Offsets[VertIdx + 1]; Slot++)
+    {
+        Sum += Adjacency.FaceNormals[Adjacency.Triangles[Slot]];
+    }
+
+    FVector3f TangentZ = Sum.GetSafeNormal();
+    if (TangentZ.IsNearlyZero())
+    {
+        TangentZ = FVector3f::UpVector;
+    }
+
+    // There are no UVs, any basis around the normal will do
+    FVector3f TangentX, TangentY;
+    TangentZ.FindBestAxisVectors(TangentX, TangentY);
+    Vertex.SetTangents(TangentX, TangentY, TangentZ);
+}
+
+void FSimpleMeshVertexAdjacency::Build(int32 NumVertices, const TArray<uint32>& Indices)
+{
+    const int32 NumTriangles = Indices.Num() / 3;
+
+    Offsets.Reset();
+    Offsets.SetNumZeroed(NumVertices + 1);
+    Triangles.SetNumUninitialized(NumTriangles * 3);
+    FaceNormals.SetNumZeroed(NumTriangles);
+
+    // Counting sort of the triangle corners by vertex
+    for (int32 Corner = 0; Corner < NumTriangles * 3; Corner++)
+    {
+        const uint32 VertIdx = Indices[Corner];
+        if (VertIdx < (uint32)NumVertices)
+        {
+            Offsets[VertIdx + 1]++;
+        }
+    }
+
+    for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+    {
+        Offsets[VertIdx + 1] += Offsets[VertIdx];
+    }
+
+    TArray<int32> Cursor(Offsets.GetData(), NumVertices);
+    for (int32 Corner = 0; Corner < NumTriangles * 3; Corner++)
+    {
+        const uint32 VertIdx = Indices[Corner];
+        if (VertIdx < (uint32)NumVertices)
+        {
+            Triangles[Cursor[VertIdx]++] = Corner / 3;
+        }
+    }
+    Triangles.SetNum(Offsets[NumVertices]);
+}
+
+namespace SimpleMeshNormals
+{
+    void ComputeSectionNormals(FSimpleMeshSection& Section)
+    {
+        SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_ComputeNormals);
+
+        TArray<FDynamicMeshVertex>& Vertices = Section.VertexBuffer;
+        const TArray<uint32>& Indices = Section.IndexBuffer;
+        FSimpleMeshVertexAdjacency& Adjacency = Section.NormalAdjacency;
+
+        const int32 NumVertices = Vertices.Num();
+        const int32 NumTriangles = Indices.Num() / 3;
+
+        // A valid adjacency is only ever built from checked indices
+        if (!Adjacency.IsValid(NumVertices, Indices.Num()))
+        {
+            if (!AreIndicesInRange(Indices, NumVertices))
+            {
+                UE_LOG(LogSimpleMeshNormals, Warning, TEXT("Section indices point past its %d vertices, normals are not generated."), NumVertices);
+                Adjacency.Reset();
+                return;
+            }
+            Adjacency.Build(NumVertices, Indices);
+        }
+
+        // Faces first, each worker owns a block of triangles
+        ParallelFor(FMath::DivideAndRoundUp(NumTriangles, NormalsBlockSize), [&](int32 BlockIndex)
+        {
+            const int32 Last = FMath::Min((BlockIndex + 1) * NormalsBlockSize, NumTriangles);
+            for (int32 TriIdx = BlockIndex * NormalsBlockSize; TriIdx < Last; TriIdx++)
+            {
+                Adjacency.FaceNormals[TriIdx] = ComputeFaceNormal(Vertices, Indices, TriIdx);
+            }
+        });
+
+        // Then vertices gather from their faces, each worker owns a block of vertices so nothing is shared
+        ParallelFor(FMath::DivideAndRoundUp(NumVertices, NormalsBlockSize), [&](int32 BlockIndex)
+        {
+            const int32 Last = FMath::Min((BlockIndex + 1) * NormalsBlockSize, NumVertices);
+            for (int32 VertIdx = BlockIndex * NormalsBlockSize; VertIdx < Last; VertIdx++)
+            {
+                ComputeVertexTangents(Vertices[VertIdx], Adjacency, VertIdx);
+            }
+        });
+    }
+
+    void UpdateSectionNormals(FSimpleMeshSection& Section, TArray<FSimpleMeshVertexRange>& DirtyRanges)
+    {
+        SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_UpdateNormals);
+
+        TArray<FDynamicMeshVertex>& Vertices = Section.VertexBuffer;
+        const TArray<uint32>& Indices = Section.IndexBuffer;
+        FSimpleMeshVertexAdjacency& Adjacency = Section.NormalAdjacency;
+
+        const int32 NumVertices = Vertices.Num();
+        const int32 NumTriangles = Indices.Num() / 3;
+
+        // Without adjacency there is nothing to be incremental about
+        if (!Adjacency.IsValid(NumVertices, Indices.Num()))
+        {
+            ComputeSectionNormals(Section);
+            DirtyRanges.Reset();
+            FSimpleMeshVertexRange::AddMerged(DirtyRanges, 0, NumVertices, 0);
+            return;
+        }
+
+        // Faces touching a moved vertex
+        TBitArray<> TriangleMask(false, NumTriangles);
+        TArray<int32> DirtyTriangles;
+        for (const FSimpleMeshVertexRange& Range : DirtyRanges)
+        {
+            for (int32 VertIdx = Range.FirstVertex; VertIdx < Range.FirstVertex + Range.NumVertices; VertIdx++)
+            {
+                for (int32 Slot = Adjacency.Offsets[VertIdx]; Slot < Adjacency.Offsets[VertIdx + 1]; Slot++)
+                {
+                    const int32 TriIdx = Adjacency.Triangles[Slot];
+                    if (!TriangleMask[TriIdx])
+                    {
+                        TriangleMask[TriIdx] = true;
+                        DirtyTriangles.Add(TriIdx);
+                    }
+                }
+            }
+        }
+
+        ParallelFor(DirtyTriangles.Num(), [&](int32 Idx)
+        {
+            Adjacency.FaceNormals[DirtyTriangles[Idx]] = ComputeFaceNormal(Vertices, Indices, DirtyTriangles[Idx]);
+        }, DirtyTriangles.Num() < NormalsBlockSize ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+        // Every corner of those faces gets a new normal, moved or not
+        TBitArray<> VertexMask(false, NumVertices);
+        for (int32 TriIdx : DirtyTriangles)
+        {
+            for (int32 Corner = 0; Corner < 3; Corner++)
+            {
+                const uint32 VertIdx = Indices[TriIdx * 3 + Corner];
+                if (VertIdx < (uint32)NumVertices)
+                {
+                    VertexMask[VertIdx] = true;
+                }
+            }
+        }
+
+        TArray<int32> DirtyVertices;
+        for (TConstSetBitIterator<> It(VertexMask); It; ++It)
+        {
+            DirtyVertices.Add(It.GetIndex());
+        }
+
+        ParallelFor(DirtyVertices.Num(), [&](int32 Idx)
+        {
+            ComputeVertexTangents(Vertices[DirtyVertices[Idx]], Adjacency, DirtyVertices[Idx]);
+        }, DirtyVertices.Num() < NormalsBlockSize ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+        // Hand the one ring around the edit back as dirty so its tangents reach the GPU
+        int32 RunStart = INDEX_NONE;
+        for (int32 Idx = 0; Idx <= DirtyVertices.Num(); Idx++)
+        {
+            const bool bContinuesRun = Idx < DirtyVertices.Num() && RunStart != INDEX_NONE && DirtyVertices[Idx] == DirtyVertices[Idx - 1] + 1;
+            if (!bContinuesRun)
+            {
+                if (RunStart != INDEX_NONE)
+                {
+                    FSimpleMeshVertexRange::AddMerged(DirtyRanges, DirtyVertices[RunStart], DirtyVertices[Idx - 1] - DirtyVertices[RunStart] + 1, USimpleMeshComponent::DirtyRangeMergeGap);
+                }
+                RunStart = Idx < DirtyVertices.Num() ? Idx : INDEX_NONE;
+            }
+        }
+    }
+}
@@ -0,0 +1,120 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHOCCLUDER---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHOCCLUDER---------//
+
+#include "SimpleMeshOccluder.h"
+#include "SimpleMeshComponent.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Build Occluder"), STAT_SimpleMesh_BuildOccluder, STATGROUP_SimpleMesh);
+
+namespace SimpleMeshOccluderPrivate
+{
+    struct FCandidate
+    {
+        float Area;
+        int32 Source;
+        int32 Triangle;
+    };
+}
+
+using namespace SimpleMeshOccluderPrivate;
+
+TSharedPtr<FSimpleMeshOccluderData, ESPMode::ThreadSafe> SimpleMeshOccluder::Build(TConstArrayView<FSimpleMeshSectionSnapshotPtr> Sources, int32 MaxTriangles, float MinTriangleArea)
+{
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_BuildOccluder);
+
+    if (MaxTriangles <= 0)
+    {
+        return nullptr;
+    }
+
+    // Triangles big enough, per section
+    TArray<TArray<FCandidate>> SourceCandidates;
+    SourceCandidates.SetNum(Sources.Num());
+    ParallelFor(Sources.Num(), [&](int32 SourceIdx)
+    {
+        const FSimpleMeshSectionSnapshot& Source = *Sources[SourceIdx];
+        const uint32 NumVertices = (uint32)Source.Positions.Num();
+        for (int32 TriIdx = 0; TriIdx < Source.Indices.Num() / 3; TriIdx++)
+        {
+            const uint32 I0 = Source.Indices[TriIdx * 3 + 0];
+            const uint32 I1 = Source.Indices[TriIdx * 3 + 1];
+            const uint32 I2 = Source.Indices[TriIdx * 3 + 2];
+            if (I0 >= NumVertices || I1 >= NumVertices || I2 >= NumVertices)
+            {
+                continue;
+            }
+
+            const float Area = 0.5f * ((Source.Positions[I1] - Source.Positions[I0]) ^ (Source.Positions[I2] - Source.Positions[I0])).Size();
+            if (Area >= MinTriangleArea)
+            {
+                SourceCandidates[SourceIdx].Add({ Area, SourceIdx, TriIdx });
+            }
+        }
+    });
+
+    TArray<FCandidate> Candidates;
+    for (TArray<FCandidate>& SourceList : SourceCandidates)
+    {
+        Candidates.Append(MoveTemp(SourceList));
+    }
+    if (Candidates.Num() == 0)
+    {
+        return nullptr;
+    }
+
+    // Biggest first, ties broken by position so the result is stable
+    Algo::Sort(Candidates, [](const FCandidate& A, const FCandidate& B)
+    {
+        if (A.Area != B.Area)
+        {
+            return A.Area > B.Area;
+        }
+        return A.Source != B.Source ? A.Source < B.Source : A.Triangle < B.Triangle;
+    });
+
+    TSharedPtr<FSimpleMeshOccluderData, ESPMode::ThreadSafe> Data = MakeShared<FSimpleMeshOccluderData, ESPMode::ThreadSafe>();
+    Data->VerticesSP = MakeShared<FOccluderVertexArray, ESPMode::ThreadSafe>();
+    Data->IndicesSP = MakeShared<FOccluderIndexArray, ESPMode::ThreadSafe>();
+    FOccluderVertexArray& OutVertices = *Data->VerticesSP;
+    FOccluderIndexArray& OutIndices = *Data->IndicesSP;
+
+    // Shared corners are stored once, keyed by section and vertex
+    TMap<uint64, uint16> VertexMap;
+    const int32 NumTriangles = FMath::Min(Candidates.Num(), MaxTriangles);
+    OutIndices.Reserve(NumTriangles * 3);
+    for (int32 CandidateIdx = 0; CandidateIdx < NumTriangles; CandidateIdx++)
+    {
+        const FCandidate& Candidate = Candidates[CandidateIdx];
+        const FSimpleMeshSectionSnapshot& Source = *Sources[Candidate.Source];
+
+        // Worst case the triangle brings three new corners
+        if (OutVertices.Num() + 3 > MAX_uint16)
+        {
+            break;
+        }
+
+        for (int32 Corner = 0; Corner < 3; Corner++)
+        {
+            const uint32 VertIdx = Source.Indices[Candidate.Triangle * 3 + Corner];
+            const uint64 Key = ((uint64)Candidate.Source << 32) | VertIdx;
+            if (const uint16* Found = VertexMap.Find(Key))
+            {
+                OutIndices.Add(*Found);
+            }
+            else
+            {
+                const uint16 NewIndex = (uint16)OutVertices.Add(FVector(Source.Positions[VertIdx]));
+                VertexMap.Add(Key, NewIndex);
+                OutIndices.Add(NewIndex);
+            }
+        }
+    }
+
+    return Data;
+}
@@ -0,0 +1,410 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHSERIALIZATION---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHSERIALIZATION---------//
+
+#include "SimpleMeshSerialization.h"
+#include "SimpleMeshComponent.h"
+#include "Serialization/CustomVersion.h"
+#include "Misc/Compression.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+#include "Async/ParallelFor.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSimpleMeshSerialization, Log, All);
+
+DECLARE_CYCLE_STAT(TEXT("Write Section Blob"), STAT_SimpleMesh_WriteSections, STATGROUP_SimpleMesh);
+DECLARE_CYCLE_STAT(TEXT("Read Section Blob"), STAT_SimpleMesh_ReadSections, STATGROUP_SimpleMesh);
+
+const FGuid FSimpleMeshCustomVersion::GUID(0x5A1E3C07, 0x4B2D41F8, 0x9C6A0E21, 0x7D3F88B4);
+
+// Register the custom version with core
+FCustomVersionRegistration GRegisterSimpleMeshCustomVersion(FSimpleMeshCustomVersion::GUID, FSimpleMeshCustomVersion::LatestVersion, TEXT("SimpleMeshVer"));
+
+namespace SimpleMeshSerialization
+{
+    static constexpr uint32 BlobMagic = 0x48534D53; // 'SMSH'
+
+    /** 2: header and table go through FArchive field by field. Same bytes as 1 on little endian platforms, which still load. */
+    static constexpr uint32 BlobVersion = 2;
+    static constexpr uint32 MinBlobVersion = 1;
+
+    /** Vertices decoded by each worker */
+    static constexpr int32 DecodeBlockSize = 4096;
+
+    /** Far above what section data compresses to: a bigger uncompressed size is corrupt and would allocate from garbage */
+    static constexpr int64 MaxCompressionRatio = 4096;
+
+    enum ESectionFlags : uint32
+    {
+        Flag_Collision = 1 << 0,
+        Flag_Visible = 1 << 1,
+        Flag_GenerateNormals = 1 << 2,
+        Flag_QuantizedPositions = 1 << 3,
+        Flag_Indices16 = 1 << 4,
+        Flag_Tangents = 1 << 5,
+    };
+
+    struct FBlobHeader
+    {
+        uint32 Magic = 0;
+        uint32 Version = 0;
+        uint32 NumSections = 0;
+        uint32 Reserved = 0;
+
+        /** Bytes taken in the blob */
+        static constexpr uint64 SerializedSize = 4 * sizeof(uint32);
+
+        friend FArchive& operator<<(FArchive& Ar, FBlobHeader& Header)
+        {
+            return Ar << Header.Magic << Header.Version << Header.NumSections << Header.Reserved;
+        }
+    };
+
+    struct FSerializedSection
+    {
+        int32 SectionIndex = 0;
+        int32 MaterialIndex = 0;
+        uint32 NumVertices = 0;
+        uint32 NumIndices = 0;
+        uint32 Flags = 0;
+        uint32 Reserved = 0;
+        uint64 PositionsOffset = 0;
+        uint64 TangentsOffset = 0;
+        uint64 IndicesOffset = 0;
+        FVector3f BoxMin = FVector3f::ZeroVector;
+        FVector3f BoxMax = FVector3f::ZeroVector;
+
+        /** Bytes taken in the blob */
+        static constexpr uint64 SerializedSize = 6 * sizeof(uint32) + 3 * sizeof(uint64) + 6 * sizeof(float);
+
+        friend FArchive& operator<<(FArchive& Ar, FSerializedSection& Entry)
+        {
+            Ar << Entry.SectionIndex << Entry.MaterialIndex << Entry.NumVertices << Entry.NumIndices << Entry.Flags << Entry.Reserved;
+            Ar << Entry.PositionsOffset << Entry.TangentsOffset << Entry.IndicesOffset;
+            return Ar << Entry.BoxMin << Entry.BoxMax;
+        }
+    };
+
+    static_assert(FBlobHeader::SerializedSize % BlobAlignment == 0, "Section table must start aligned");
+    static_assert(FSerializedSection::SerializedSize % 8 == 0, "Section table entries must stay 8 byte aligned");
+
+    /** Reserve an aligned block at the end of the blob and return its offset */
+    static uint64 AllocateBlock(TArray<uint8>& Blob, uint64 NumBytes)
+    {
+        const uint64 Offset = Align((uint64)Blob.Num(), (uint64)BlobAlignment);
+        Blob.SetNumZeroed(Offset + NumBytes);
+        return Offset;
+    }
+
+    void WriteSections(TConstArrayView<const FSimpleMeshSection*> Sections, TConstArrayView<int32> SectionIndices, bool bQuantizePositions, TArray<uint8>& OutBlob)
+    {
+        SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_WriteSections);
+        check(Sections.Num() == SectionIndices.Num());
+
+        OutBlob.Reset();
+        AllocateBlock(OutBlob, FBlobHeader::SerializedSize + Sections.Num() * FSerializedSection::SerializedSize);
+
+        TArray<FSerializedSection> Table;
+        Table.SetNum(Sections.Num());
+
+        for (int32 Idx = 0; Idx < Sections.Num(); Idx++)
+        {
+            const FSimpleMeshSection& Section = *Sections[Idx];
+            FSerializedSection& Entry = Table[Idx];
+
+            const int32 NumVertices = Section.VertexBuffer.Num();
+            const bool bQuantize = bQuantizePositions && Section.SectionLocalBox.IsValid;
+            const bool bIndices16 = NumVertices <= MAX_uint16 + 1;
+            const bool bTangents = Section.bGenerateNormals;
+
+            Entry.SectionIndex = SectionIndices[Idx];
+            Entry.MaterialIndex = Section.MaterialIndex;
+            Entry.NumVertices = NumVertices;
+            Entry.NumIndices = Section.IndexBuffer.Num();
+            Entry.Flags = (Section.bEnableCollision ? Flag_Collision : 0)
+                | (Section.Visible ? Flag_Visible : 0)
+                | (Section.bGenerateNormals ? Flag_GenerateNormals : 0)
+                | (bQuantize ? Flag_QuantizedPositions : 0)
+                | (bIndices16 ? Flag_Indices16 : 0)
+                | (bTangents ? Flag_Tangents : 0);
+            Entry.BoxMin = Section.SectionLocalBox.IsValid ? FVector3f(Section.SectionLocalBox.Min) : FVector3f::ZeroVector;
+            Entry.BoxMax = Section.SectionLocalBox.IsValid ? FVector3f(Section.SectionLocalBox.Max) : FVector3f::ZeroVector;
+
+            // Every block is allocated first, the writers below then only overwrite bytes inside the blob and never grow it
+            Entry.PositionsOffset = AllocateBlock(OutBlob, (uint64)NumVertices * (bQuantize ? 3 * sizeof(uint16) : 3 * sizeof(float)));
+            Entry.TangentsOffset = bTangents ? AllocateBlock(OutBlob, (uint64)NumVertices * 2 * sizeof(uint32)) : 0;
+            Entry.IndicesOffset = AllocateBlock(OutBlob, (uint64)Entry.NumIndices * (bIndices16 ? sizeof(uint16) : sizeof(uint32)));
+
+            // Positions, either raw or 16 bits per component relative to the section box. Each worker writes its own slice.
+            const FVector3f Extent = Entry.BoxMax - Entry.BoxMin;
+            const FVector3f Scale(
+                Extent.X > 0.f ? MAX_uint16 / Extent.X : 0.f,
+                Extent.Y > 0.f ? MAX_uint16 / Extent.Y : 0.f,
+                Extent.Z > 0.f ? MAX_uint16 / Extent.Z : 0.f);
+            ParallelFor(FMath::DivideAndRoundUp(NumVertices, DecodeBlockSize), [&](int32 BlockIndex)
+            {
+                const int32 First = BlockIndex * DecodeBlockSize;
+                const int32 Last = FMath::Min(First + DecodeBlockSize, NumVertices);
+
+                FMemoryWriter Writer(OutBlob, true);
+                Writer.Seek(Entry.PositionsOffset + (uint64)First * (bQuantize ? 3 * sizeof(uint16) : 3 * sizeof(float)));
+                for (int32 VertIdx = First; VertIdx < Last; VertIdx++)
+                {
+                    FVector3f Position = Section.VertexBuffer[VertIdx].Position;
+                    if (bQuantize)
+                    {
+                        const FVector3f Local = (Position - Entry.BoxMin) * Scale;
+                        uint16 X = (uint16)FMath::Clamp(FMath::RoundToInt(Local.X), 0, (int32)MAX_uint16);
+                        uint16 Y = (uint16)FMath::Clamp(FMath::RoundToInt(Local.Y), 0, (int32)MAX_uint16);
+                        uint16 Z = (uint16)FMath::Clamp(FMath::RoundToInt(Local.Z), 0, (int32)MAX_uint16);
+                        Writer << X << Y << Z;
+                    }
+                    else
+                    {
+                        Writer << Position;
+                    }
+                }
+
+                // Tangent frames are only worth keeping when they were generated
+                if (bTangents)
+                {
+                    Writer.Seek(Entry.TangentsOffset + (uint64)First * 2 * sizeof(uint32));
+                    for (int32 VertIdx = First; VertIdx < Last; VertIdx++)
+                    {
+                        FPackedNormal TangentX = Section.VertexBuffer[VertIdx].TangentX;
+                        FPackedNormal TangentZ = Section.VertexBuffer[VertIdx].TangentZ;
+                        Writer << TangentX << TangentZ;
+                    }
+                }
+            });
+
+            FMemoryWriter IndexWriter(OutBlob, true);
+            IndexWriter.Seek(Entry.IndicesOffset);
+            for (uint32 Index : Section.IndexBuffer)
+            {
+                if (bIndices16)
+                {
+                    uint16 Index16 = (uint16)Index;
+                    IndexWriter << Index16;
+                }
+                else
+                {
+                    IndexWriter << Index;
+                }
+            }
+        }
+
+        FBlobHeader Header;
+        Header.Magic = BlobMagic;
+        Header.Version = BlobVersion;
+        Header.NumSections = Sections.Num();
+
+        FMemoryWriter Writer(OutBlob, true);
+        Writer << Header;
+        for (FSerializedSection& Entry : Table)
+        {
+            Writer << Entry;
+        }
+        check(Writer.Tell() == FBlobHeader::SerializedSize + Table.Num() * FSerializedSection::SerializedSize);
+    }
+
+    static bool IsBlockInBlob(TConstArrayView<uint8> Blob, uint64 Offset, uint64 NumBytes)
+    {
+        return Offset <= (uint64)Blob.Num() && NumBytes <= (uint64)Blob.Num() - Offset;
+    }
+
+    bool ReadSections(TConstArrayView<uint8> Blob, TSparseArray<FSimpleMeshSection>& OutSections)
+    {
+        SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_ReadSections);
+
+        OutSections.Empty();
+        if (Blob.Num() == 0)
+        {
+            return true;
+        }
+
+        if (!IsBlockInBlob(Blob, 0, FBlobHeader::SerializedSize))
+        {
+            return false;
+        }
+
+        FMemoryReaderView Reader(Blob, true);
+        FBlobHeader Header;
+        Reader << Header;
+        if (Header.Magic != BlobMagic || Header.Version < MinBlobVersion || Header.Version > BlobVersion
+            || !IsBlockInBlob(Blob, FBlobHeader::SerializedSize, (uint64)Header.NumSections * FSerializedSection::SerializedSize))
+        {
+            UE_LOG(LogSimpleMeshSerialization, Warning, TEXT("Unrecognized section blob (magic %08x, version %u)."), Header.Magic, Header.Version);
+            return false;
+        }
+
+        TArray<FSerializedSection> Table;
+        Table.SetNum(Header.NumSections);
+        for (FSerializedSection& Entry : Table)
+        {
+            Reader << Entry;
+        }
+
+        // Validate the whole table before touching the output
+        TSet<int32> SectionIndices;
+        for (const FSerializedSection& Entry : Table)
+        {
+            const bool bQuantized = (Entry.Flags & Flag_QuantizedPositions) != 0;
+            const uint64 PositionBytes = (uint64)Entry.NumVertices * (bQuantized ? 3 * sizeof(uint16) : 3 * sizeof(float));
+            const uint64 TangentBytes = (Entry.Flags & Flag_Tangents) ? (uint64)Entry.NumVertices * 2 * sizeof(uint32) : 0;
+            const uint64 IndexBytes = (uint64)Entry.NumIndices * ((Entry.Flags & Flag_Indices16) ? sizeof(uint16) : sizeof(uint32));
+
+            bool bDuplicate = false;
+            SectionIndices.Add(Entry.SectionIndex, &bDuplicate);
+
+            if (Entry.SectionIndex < 0 || Entry.SectionIndex > MaxSectionIndex || bDuplicate || Entry.NumVertices > (uint32)MAX_int32 || Entry.NumIndices > (uint32)MAX_int32
+                || !IsBlockInBlob(Blob, Entry.PositionsOffset, PositionBytes)
+                || !IsBlockInBlob(Blob, Entry.TangentsOffset, TangentBytes)
+                || !IsBlockInBlob(Blob, Entry.IndicesOffset, IndexBytes))
+            {
+                UE_LOG(LogSimpleMeshSerialization, Warning, TEXT("Corrupt section blob, entry for section %d is out of bounds."), Entry.SectionIndex);
+                return false;
+            }
+        }
+
+        for (const FSerializedSection& Entry : Table)
+        {
+            const int32 NumVertices = Entry.NumVertices;
+
+            // Indices first: a section is only committed once every index is known to point at one of its vertices
+            TArray<uint32> Indices;
+            Indices.SetNumUninitialized(Entry.NumIndices);
+            Reader.Seek(Entry.IndicesOffset);
+            uint32 MaxIndex = 0;
+            for (uint32& Index : Indices)
+            {
+                if (Entry.Flags & Flag_Indices16)
+                {
+                    uint16 Index16;
+                    Reader << Index16;
+                    Index = Index16;
+                }
+                else
+                {
+                    Reader << Index;
+                }
+                MaxIndex = FMath::Max(MaxIndex, Index);
+            }
+            if (Indices.Num() > 0 && MaxIndex >= (uint32)NumVertices)
+            {
+                UE_LOG(LogSimpleMeshSerialization, Warning, TEXT("Corrupt section blob, section %d has index %u for %d vertices."), Entry.SectionIndex, MaxIndex, NumVertices);
+                OutSections.Empty();
+                return false;
+            }
+
+            // Sections go back to their slot, the slots in between stay free
+            OutSections.Insert(Entry.SectionIndex, FSimpleMeshSection());
+            FSimpleMeshSection& Section = OutSections[Entry.SectionIndex];
+            Section.MaterialIndex = Entry.MaterialIndex;
+            Section.bEnableCollision = (Entry.Flags & Flag_Collision) != 0;
+            Section.Visible = (Entry.Flags & Flag_Visible) != 0;
+            Section.bGenerateNormals = (Entry.Flags & Flag_GenerateNormals) != 0;
+            Section.SectionLocalBox = Entry.NumVertices > 0 ? FBox(FVector(Entry.BoxMin), FVector(Entry.BoxMax)) : FBox(ForceInit);
+            Section.IndexBuffer = MoveTemp(Indices);
+            Section.VertexBuffer.SetNum(NumVertices);
+
+            const bool bQuantized = (Entry.Flags & Flag_QuantizedPositions) != 0;
+            const bool bTangents = (Entry.Flags & Flag_Tangents) != 0;
+            const FVector3f Extent = Entry.BoxMax - Entry.BoxMin;
+            const FVector3f Scale = Extent / (float)MAX_uint16;
+
+            // Fixed stride blocks, so each worker reads its own slice with its own reader
+            ParallelFor(FMath::DivideAndRoundUp(NumVertices, DecodeBlockSize), [&](int32 BlockIndex)
+            {
+                const int32 First = BlockIndex * DecodeBlockSize;
+                const int32 Last = FMath::Min(First + DecodeBlockSize, NumVertices);
+
+                FMemoryReaderView BlockReader(Blob, true);
+                BlockReader.Seek(Entry.PositionsOffset + (uint64)First * (bQuantized ? 3 * sizeof(uint16) : 3 * sizeof(float)));
+                for (int32 VertIdx = First; VertIdx < Last; VertIdx++)
+                {
+                    if (bQuantized)
+                    {
+                        uint16 X, Y, Z;
+                        BlockReader << X << Y << Z;
+                        Section.VertexBuffer[VertIdx].Position = Entry.BoxMin + FVector3f((float)X, (float)Y, (float)Z) * Scale;
+                    }
+                    else
+                    {
+                        BlockReader << Section.VertexBuffer[VertIdx].Position;
+                    }
+                }
+
+                if (bTangents)
+                {
+                    BlockReader.Seek(Entry.TangentsOffset + (uint64)First * 2 * sizeof(uint32));
+                    for (int32 VertIdx = First; VertIdx < Last; VertIdx++)
+                    {
+                        BlockReader << Section.VertexBuffer[VertIdx].TangentX << Section.VertexBuffer[VertIdx].TangentZ;
+                    }
+                }
+            });
+        }
+
+        return true;
+    }
+
+    void SerializeBlob(FArchive& Ar, TArray<uint8>& Blob, bool bCompress)
+    {
+        TArray<uint8> Compressed;
+        bool bCompressed = false;
+
+        if (Ar.IsSaving() && bCompress && Blob.Num() > 0)
+        {
+            int32 CompressedSize = FCompression::CompressMemoryBound(NAME_Oodle, Blob.Num());
+            Compressed.SetNumUninitialized(CompressedSize);
+            bCompressed = FCompression::CompressMemory(NAME_Oodle, Compressed.GetData(), CompressedSize, Blob.GetData(), Blob.Num());
+            Compressed.SetNum(bCompressed ? CompressedSize : 0);
+        }
+
+        int64 UncompressedSize = Blob.Num();
+        Ar << bCompressed;
+        Ar << UncompressedSize;
+
+        // What is left of the archive bounds what the sizes may claim, when the archive knows its size
+        const int64 RemainingBytes = Ar.IsLoading() && Ar.TotalSize() > 0 ? Ar.TotalSize() - Ar.Tell() : MAX_int64;
+        if (Ar.IsLoading())
+        {
+            const int64 MaxUncompressedSize = bCompressed ? (RemainingBytes > MAX_int32 / MaxCompressionRatio ? (int64)MAX_int32 : RemainingBytes * MaxCompressionRatio) : RemainingBytes;
+            if (UncompressedSize < 0 || UncompressedSize > FMath::Min(MaxUncompressedSize, (int64)MAX_int32))
+            {
+                UE_LOG(LogSimpleMeshSerialization, Warning, TEXT("Section blob claims %lld bytes with %lld left in the archive."), UncompressedSize, RemainingBytes);
+                Ar.SetError();
+                Blob.Reset();
+                return;
+            }
+        }
+
+        if (!bCompressed)
+        {
+            // One bulk copy, no per element serialization
+            Blob.BulkSerialize(Ar);
+            if (Ar.IsLoading() && Blob.Num() != UncompressedSize)
+            {
+                UE_LOG(LogSimpleMeshSerialization, Warning, TEXT("Section blob holds %d bytes, %lld expected."), Blob.Num(), UncompressedSize);
+                Blob.Reset();
+            }
+            return;
+        }
+
+        Compressed.BulkSerialize(Ar);
+
+        if (Ar.IsLoading())
+        {
+            Blob.SetNumUninitialized(UncompressedSize);
+            if (Ar.IsError() || !FCompression::UncompressMemory(NAME_Oodle, Blob.GetData(), Blob.Num(), Compressed.GetData(), Compressed.Num()))
+            {
+                UE_LOG(LogSimpleMeshSerialization, Warning, TEXT("Failed to decompress section blob."));
+                Blob.Reset();
+            }
+        }
+    }
+}
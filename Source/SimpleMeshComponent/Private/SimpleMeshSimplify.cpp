@@ -0,0 +1,427 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHSIMPLIFY---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHSIMPLIFY---------//
+
+#include "SimpleMeshSimplify.h"
+#include "SimpleMeshComponent.h"
+#include "SimpleMeshBVH.h"
+#include "DynamicMeshBuilder.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Simplify Mesh"), STAT_SimpleMesh_Simplify, STATGROUP_SimpleMesh);
+DECLARE_CYCLE_STAT(TEXT("Measure Deviation"), STAT_SimpleMesh_MeasureDeviation, STATGROUP_SimpleMesh);
+
+namespace SimpleMeshSimplifyPrivate
+{
+    /** Collapses may not turn a remaining triangle further than this from its normal (cosine) */
+    static constexpr double MinNormalDot = 0.2;
+
+    /** Share of MaxError the vertices may use, the quadrics only bound the distance at the vertices, not across the new triangles */
+    static constexpr double VertexErrorShare = 0.5;
+
+    /** Symmetric 4x4 matrix giving the sum of the squared distances to a set of planes */
+    struct FQuadric
+    {
+        double XX = 0.0, XY = 0.0, XZ = 0.0, XW = 0.0;
+        double YY = 0.0, YZ = 0.0, YW = 0.0;
+        double ZZ = 0.0, ZW = 0.0;
+        double WW = 0.0;
+
+        /** Plane of points P with (Normal | P) + D = 0, Normal normalized */
+        static FQuadric FromPlane(const FVector3d& Normal, double D)
+        {
+            FQuadric Quadric;
+            Quadric.XX = Normal.X * Normal.X; Quadric.XY = Normal.X * Normal.Y; Quadric.XZ = Normal.X * Normal.Z; Quadric.XW = Normal.X * D;
+            Quadric.YY = Normal.Y * Normal.Y; Quadric.YZ = Normal.Y * Normal.Z; Quadric.YW = Normal.Y * D;
+            Quadric.ZZ = Normal.Z * Normal.Z; Quadric.ZW = Normal.Z * D;
+            Quadric.WW = D * D;
+            return Quadric;
+        }
+
+        FQuadric& operator+=(const FQuadric& Other)
+        {
+            XX += Other.XX; XY += Other.XY; XZ += Other.XZ; XW += Other.XW;
+            YY += Other.YY; YZ += Other.YZ; YW += Other.YW;
+            ZZ += Other.ZZ; ZW += Other.ZW;
+            WW += Other.WW;
+            return *this;
+        }
+
+        double Evaluate(const FVector3d& P) const
+        {
+            return XX * P.X * P.X + YY * P.Y * P.Y + ZZ * P.Z * P.Z
+                + 2.0 * (XY * P.X * P.Y + XZ * P.X * P.Z + YZ * P.Y * P.Z)
+                + 2.0 * (XW * P.X + YW * P.Y + ZW * P.Z)
+                + WW;
+        }
+    };
+
+    /** Remove goes onto Keep. Stale once either vertex changed, the stamps tell. */
+    struct FCollapse
+    {
+        double Cost;
+        int32 Keep;
+        int32 Remove;
+        uint32 KeepStamp;
+        uint32 RemoveStamp;
+
+        bool operator<(const FCollapse& Other) const
+        {
+            return Cost < Other.Cost;
+        }
+    };
+
+    FORCEINLINE uint64 GetEdgeKey(int32 A, int32 B)
+    {
+        return A < B ? ((uint64)A << 32) | (uint32)B : ((uint64)B << 32) | (uint32)A;
+    }
+
+    /** Same winding as the generated normals, not normalized */
+    FORCEINLINE FVector3d GetFaceNormal(const FVector3d& P0, const FVector3d& P1, const FVector3d& P2)
+    {
+        return (P1 - P2) ^ (P0 - P2);
+    }
+
+    FORCEINLINE bool HasCorner(const FIntVector& Triangle, int32 Vertex)
+    {
+        return Triangle.X == Vertex || Triangle.Y == Vertex || Triangle.Z == Vertex;
+    }
+
+    /** Largest distance from the sample points of the From triangles to the To surface */
+    static float MeasureOneWay(TConstArrayView<FVector3f> FromPositions, TConstArrayView<uint32> FromIndices, TConstArrayView<FVector3f> ToPositions, TConstArrayView<uint32> ToIndices, float SearchDistance)
+    {
+        TArray<FDynamicMeshVertex> ToVertices;
+        ToVertices.SetNum(ToPositions.Num());
+        for (int32 VertIdx = 0; VertIdx < ToPositions.Num(); VertIdx++)
+        {
+            ToVertices[VertIdx].Position = ToPositions[VertIdx];
+        }
+
+        FSimpleMeshBVH BVH;
+        BVH.Build(ToVertices, ToIndices);
+
+        const int32 NumTriangles = FromIndices.Num() / 3;
+        TArray<float> TriangleDeviations;
+        TriangleDeviations.SetNumZeroed(NumTriangles);
+        ParallelFor(NumTriangles, [&](int32 TriIdx)
+        {
+            const uint32 I0 = FromIndices[TriIdx * 3], I1 = FromIndices[TriIdx * 3 + 1], I2 = FromIndices[TriIdx * 3 + 2];
+            if (I0 >= (uint32)FromPositions.Num() || I1 >= (uint32)FromPositions.Num() || I2 >= (uint32)FromPositions.Num())
+            {
+                return;
+            }
+
+            const FVector3f& P0 = FromPositions[I0];
+            const FVector3f& P1 = FromPositions[I1];
+            const FVector3f& P2 = FromPositions[I2];
+            const FVector3f Samples[] = { P0, P1, P2, (P0 + P1) * 0.5f, (P1 + P2) * 0.5f, (P2 + P0) * 0.5f, (P0 + P1 + P2) / 3.f };
+
+            TArray<int32> Candidates;
+            float Deviation = 0.f;
+            for (const FVector3f& Sample : Samples)
+            {
+                Candidates.Reset();
+                BVH.OverlapBox(ToVertices, ToIndices, FBox3f(Sample - FVector3f(SearchDistance), Sample + FVector3f(SearchDistance)), Candidates);
+
+                double ClosestDistSq = FMath::Square((double)SearchDistance);
+                for (const int32 Candidate : Candidates)
+                {
+                    const FVector Closest = FMath::ClosestPointOnTriangleToPoint(FVector(Sample),
+                        FVector(ToPositions[ToIndices[Candidate * 3]]), FVector(ToPositions[ToIndices[Candidate * 3 + 1]]), FVector(ToPositions[ToIndices[Candidate * 3 + 2]]));
+                    ClosestDistSq = FMath::Min(ClosestDistSq, FVector::DistSquared(Closest, FVector(Sample)));
+                }
+                Deviation = FMath::Max(Deviation, (float)FMath::Sqrt(ClosestDistSq));
+            }
+            TriangleDeviations[TriIdx] = Deviation;
+        });
+
+        float MaxDeviation = 0.f;
+        for (const float Deviation : TriangleDeviations)
+        {
+            MaxDeviation = FMath::Max(MaxDeviation, Deviation);
+        }
+        return MaxDeviation;
+    }
+}
+
+using namespace SimpleMeshSimplifyPrivate;
+
+int32 SimpleMeshSimplify::SimplifyMesh(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices, float MaxError, TArray<FVector3f>& OutPositions, TArray<uint32>& OutIndices)
+{
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_Simplify);
+
+    OutPositions.Reset();
+    OutIndices.Reset();
+
+    // Merge the vertices split for normals or UVs, the collapses need the connectivity
+    TArray<FVector3d> Vertices;
+    TArray<int32> Remap;
+    Remap.SetNumUninitialized(Positions.Num());
+    {
+        TMap<FVector3f, int32> UniquePositions;
+        UniquePositions.Reserve(Positions.Num());
+        for (int32 VertIdx = 0; VertIdx < Positions.Num(); VertIdx++)
+        {
+            if (const int32* Existing = UniquePositions.Find(Positions[VertIdx]))
+            {
+                Remap[VertIdx] = *Existing;
+            }
+            else
+            {
+                Remap[VertIdx] = Vertices.Add(FVector3d(Positions[VertIdx]));
+                UniquePositions.Add(Positions[VertIdx], Remap[VertIdx]);
+            }
+        }
+    }
+    const int32 NumVertices = Vertices.Num();
+
+    TArray<FIntVector> Triangles;
+    Triangles.Reserve(Indices.Num() / 3);
+    for (int32 Idx = 0; Idx + 2 < Indices.Num(); Idx += 3)
+    {
+        if (Indices[Idx] >= (uint32)Positions.Num() || Indices[Idx + 1] >= (uint32)Positions.Num() || Indices[Idx + 2] >= (uint32)Positions.Num())
+        {
+            continue;
+        }
+
+        const FIntVector Triangle(Remap[Indices[Idx]], Remap[Indices[Idx + 1]], Remap[Indices[Idx + 2]]);
+        if (Triangle.X != Triangle.Y && Triangle.Y != Triangle.Z && Triangle.Z != Triangle.X)
+        {
+            Triangles.Add(Triangle);
+        }
+    }
+
+    // Borders and non manifold edges are not shared by exactly 2 triangles, their vertices never move
+    TMap<uint64, int32> EdgeCounts;
+    EdgeCounts.Reserve(Triangles.Num() * 3 / 2);
+    for (const FIntVector& Triangle : Triangles)
+    {
+        EdgeCounts.FindOrAdd(GetEdgeKey(Triangle.X, Triangle.Y))++;
+        EdgeCounts.FindOrAdd(GetEdgeKey(Triangle.Y, Triangle.Z))++;
+        EdgeCounts.FindOrAdd(GetEdgeKey(Triangle.Z, Triangle.X))++;
+    }
+
+    TBitArray<> Locked(false, NumVertices);
+    for (const TPair<uint64, int32>& Edge : EdgeCounts)
+    {
+        if (Edge.Value != 2)
+        {
+            Locked[(int32)(Edge.Key >> 32)] = true;
+            Locked[(int32)(Edge.Key & 0xFFFFFFFFull)] = true;
+        }
+    }
+
+    TArray<FQuadric> Quadrics;
+    Quadrics.SetNum(NumVertices);
+    TArray<TArray<int32, TInlineAllocator<8>>> VertexTriangles;
+    VertexTriangles.SetNum(NumVertices);
+    for (int32 TriIdx = 0; TriIdx < Triangles.Num(); TriIdx++)
+    {
+        const FIntVector& Triangle = Triangles[TriIdx];
+        const FVector3d Normal = GetFaceNormal(Vertices[Triangle.X], Vertices[Triangle.Y], Vertices[Triangle.Z]).GetSafeNormal();
+        if (!Normal.IsZero())
+        {
+            const FQuadric Plane = FQuadric::FromPlane(Normal, -(Normal | Vertices[Triangle.X]));
+            Quadrics[Triangle.X] += Plane;
+            Quadrics[Triangle.Y] += Plane;
+            Quadrics[Triangle.Z] += Plane;
+        }
+
+        VertexTriangles[Triangle.X].Add(TriIdx);
+        VertexTriangles[Triangle.Y].Add(TriIdx);
+        VertexTriangles[Triangle.Z].Add(TriIdx);
+    }
+
+    const double MaxCost = FMath::Square(VertexErrorShare * FMath::Max(MaxError, 0.f));
+    TArray<uint32> Stamps;
+    Stamps.SetNumZeroed(NumVertices);
+    TBitArray<> VertexAlive(true, NumVertices);
+    TBitArray<> TriangleAlive(true, Triangles.Num());
+    TArray<FCollapse> Heap;
+
+    // The kept vertex does not move, so its cost is the sum of the squared distances to the planes of both vertices
+    auto PushCollapse = [&](int32 A, int32 B)
+    {
+        if (Locked[A] && Locked[B])
+        {
+            return;
+        }
+
+        FQuadric Sum = Quadrics[A];
+        Sum += Quadrics[B];
+        const double CostKeepA = Locked[B] ? MAX_dbl : Sum.Evaluate(Vertices[A]);
+        const double CostKeepB = Locked[A] ? MAX_dbl : Sum.Evaluate(Vertices[B]);
+        const bool bKeepA = CostKeepA <= CostKeepB;
+        const double Cost = FMath::Max(bKeepA ? CostKeepA : CostKeepB, 0.0);
+        if (Cost > MaxCost)
+        {
+            return;
+        }
+
+        const int32 Keep = bKeepA ? A : B;
+        const int32 Remove = bKeepA ? B : A;
+        Heap.HeapPush({ Cost, Keep, Remove, Stamps[Keep], Stamps[Remove] });
+    };
+
+    for (const TPair<uint64, int32>& Edge : EdgeCounts)
+    {
+        PushCollapse((int32)(Edge.Key >> 32), (int32)(Edge.Key & 0xFFFFFFFFull));
+    }
+    EdgeCounts.Empty();
+
+    int32 NumTriangles = Triangles.Num();
+    TArray<int32, TInlineAllocator<32>> KeepNeighbors;
+    TArray<int32, TInlineAllocator<32>> RemoveNeighbors;
+    while (Heap.Num() > 0)
+    {
+        FCollapse Collapse;
+        Heap.HeapPop(Collapse, false);
+
+        const int32 Keep = Collapse.Keep;
+        const int32 Remove = Collapse.Remove;
+        if (!VertexAlive[Keep] || !VertexAlive[Remove] || Stamps[Keep] != Collapse.KeepStamp || Stamps[Remove] != Collapse.RemoveStamp)
+        {
+            continue;
+        }
+
+        // Link condition: the two vertices may only share the vertices opposite to their edge, otherwise the surface pinches
+        KeepNeighbors.Reset();
+        RemoveNeighbors.Reset();
+        int32 NumShared = 0;
+        for (const int32 TriIdx : VertexTriangles[Remove])
+        {
+            if (TriangleAlive[TriIdx])
+            {
+                const FIntVector& Triangle = Triangles[TriIdx];
+                NumShared += HasCorner(Triangle, Keep) ? 1 : 0;
+                RemoveNeighbors.AddUnique(Triangle.X);
+                RemoveNeighbors.AddUnique(Triangle.Y);
+                RemoveNeighbors.AddUnique(Triangle.Z);
+            }
+        }
+        for (const int32 TriIdx : VertexTriangles[Keep])
+        {
+            if (TriangleAlive[TriIdx])
+            {
+                const FIntVector& Triangle = Triangles[TriIdx];
+                KeepNeighbors.AddUnique(Triangle.X);
+                KeepNeighbors.AddUnique(Triangle.Y);
+                KeepNeighbors.AddUnique(Triangle.Z);
+            }
+        }
+
+        int32 NumCommon = 0;
+        for (const int32 Neighbor : KeepNeighbors)
+        {
+            NumCommon += (Neighbor != Keep && Neighbor != Remove && RemoveNeighbors.Contains(Neighbor)) ? 1 : 0;
+        }
+        if (NumShared == 0 || NumCommon != NumShared)
+        {
+            continue;
+        }
+
+        // Triangles of Remove that remain must not flip or become degenerate
+        bool bFlips = false;
+        for (const int32 TriIdx : VertexTriangles[Remove])
+        {
+            const FIntVector& Triangle = Triangles[TriIdx];
+            if (!TriangleAlive[TriIdx] || HasCorner(Triangle, Keep))
+            {
+                continue;
+            }
+
+            FVector3d Corners[3] = { Vertices[Triangle.X], Vertices[Triangle.Y], Vertices[Triangle.Z] };
+            const FVector3d OldNormal = GetFaceNormal(Corners[0], Corners[1], Corners[2]).GetSafeNormal();
+            Corners[Triangle.X == Remove ? 0 : (Triangle.Y == Remove ? 1 : 2)] = Vertices[Keep];
+            const FVector3d NewNormal = GetFaceNormal(Corners[0], Corners[1], Corners[2]).GetSafeNormal();
+            if ((OldNormal | NewNormal) < MinNormalDot)
+            {
+                bFlips = true;
+                break;
+            }
+        }
+        if (bFlips)
+        {
+            continue;
+        }
+
+        for (const int32 TriIdx : VertexTriangles[Remove])
+        {
+            if (!TriangleAlive[TriIdx])
+            {
+                continue;
+            }
+
+            FIntVector& Triangle = Triangles[TriIdx];
+            if (HasCorner(Triangle, Keep))
+            {
+                TriangleAlive[TriIdx] = false;
+                NumTriangles--;
+            }
+            else
+            {
+                Triangle.X = Triangle.X == Remove ? Keep : Triangle.X;
+                Triangle.Y = Triangle.Y == Remove ? Keep : Triangle.Y;
+                Triangle.Z = Triangle.Z == Remove ? Keep : Triangle.Z;
+                VertexTriangles[Keep].Add(TriIdx);
+            }
+        }
+        VertexTriangles[Remove].Empty();
+        VertexAlive[Remove] = false;
+        Quadrics[Keep] += Quadrics[Remove];
+        Stamps[Keep]++;
+
+        VertexTriangles[Keep].RemoveAllSwap([&TriangleAlive](int32 TriIdx) { return !TriangleAlive[TriIdx]; });
+        KeepNeighbors.Reset();
+        for (const int32 TriIdx : VertexTriangles[Keep])
+        {
+            const FIntVector& Triangle = Triangles[TriIdx];
+            KeepNeighbors.AddUnique(Triangle.X);
+            KeepNeighbors.AddUnique(Triangle.Y);
+            KeepNeighbors.AddUnique(Triangle.Z);
+        }
+        for (const int32 Neighbor : KeepNeighbors)
+        {
+            if (Neighbor != Keep)
+            {
+                PushCollapse(Keep, Neighbor);
+            }
+        }
+    }
+
+    // Compact what is left, in triangle order
+    TArray<int32> NewIndices;
+    NewIndices.Init(INDEX_NONE, NumVertices);
+    OutIndices.Reserve(NumTriangles * 3);
+    for (int32 TriIdx = 0; TriIdx < Triangles.Num(); TriIdx++)
+    {
+        if (!TriangleAlive[TriIdx])
+        {
+            continue;
+        }
+
+        const FIntVector& Triangle = Triangles[TriIdx];
+        for (const int32 Corner : { Triangle.X, Triangle.Y, Triangle.Z })
+        {
+            if (NewIndices[Corner] == INDEX_NONE)
+            {
+                NewIndices[Corner] = OutPositions.Add(FVector3f(Vertices[Corner]));
+            }
+            OutIndices.Add((uint32)NewIndices[Corner]);
+        }
+    }
+
+    return NumTriangles;
+}
+
+float SimpleMeshSimplify::ComputeMaxDeviation(TConstArrayView<FVector3f> PositionsA, TConstArrayView<uint32> IndicesA, TConstArrayView<FVector3f> PositionsB, TConstArrayView<uint32> IndicesB, float SearchDistance)
+{
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_MeasureDeviation);
+
+    return FMath::Max(
+        MeasureOneWay(PositionsA, IndicesA, PositionsB, IndicesB, SearchDistance),
+        MeasureOneWay(PositionsB, IndicesB, PositionsA, IndicesA, SearchDistance));
+}
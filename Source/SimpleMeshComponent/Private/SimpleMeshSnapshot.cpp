@@ -0,0 +1,40 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHSNAPSHOT---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHSNAPSHOT---------//
+
+#include "SimpleMeshSnapshot.h"
+#include "SimpleMeshComponent.h"
+
+DECLARE_CYCLE_STAT(TEXT("Make Section Snapshot"), STAT_SimpleMesh_MakeSectionSnapshot, STATGROUP_SimpleMesh);
+
+FSimpleMeshSectionSnapshotPtr SimpleMeshSnapshot::MakeSectionSnapshot(const FSimpleMeshSection& Section, int32 SectionIndex, uint32 Version)
+{
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_MakeSectionSnapshot);
+
+    TSharedRef<FSimpleMeshSectionSnapshot, ESPMode::ThreadSafe> Snapshot = MakeShared<FSimpleMeshSectionSnapshot, ESPMode::ThreadSafe>();
+    Snapshot->SectionIndex = SectionIndex;
+    Snapshot->Version = Version;
+    if (Section.GetNumVertices() == 0 && Section.ReleasedSnapshot.IsValid())
+    {
+        // Nothing left on the section, the copy taken by the release stands in
+        Snapshot->Positions = Section.ReleasedSnapshot->Positions;
+        Snapshot->Indices = Section.ReleasedSnapshot->Indices;
+    }
+    else
+    {
+        Snapshot->Positions.SetNumUninitialized(Section.GetNumVertices());
+        for (int32 VertIdx = 0; VertIdx < Snapshot->Positions.Num(); VertIdx++)
+        {
+            Snapshot->Positions[VertIdx] = Section.GetPosition(VertIdx);
+        }
+        Snapshot->Indices = Section.IndexBuffer;
+    }
+    Snapshot->LocalBox = Section.SectionLocalBox;
+    Snapshot->MaterialIndex = Section.MaterialIndex;
+    Snapshot->bVisible = Section.Visible;
+    Snapshot->bEnableCollision = Section.bEnableCollision;
+    return Snapshot;
+}
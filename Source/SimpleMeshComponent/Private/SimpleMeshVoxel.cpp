@@ -0,0 +1,417 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHVOXEL---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHVOXEL---------//
+
+#include "SimpleMeshVoxel.h"
+#include "SimpleMeshComponent.h"
+#include "DynamicMeshBuilder.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Mesh Voxel Grid"), STAT_SimpleMesh_MeshVoxelGrid, STATGROUP_SimpleMesh);
+
+namespace SimpleMeshVoxelPrivate
+{
+    /** Geometry of one material produced by one slice */
+    struct FSliceBuffer
+    {
+        TArray<FDynamicMeshVertex> Vertices;
+        TArray<uint32> Indices;
+    };
+
+    /** Everything one slice produced, indexed by material slot */
+    typedef TArray<FSliceBuffer> FSliceOutput;
+
+    FORCEINLINE FSliceBuffer& GetBuffer(FSliceOutput& Output, uint8 Material)
+    {
+        if (Output.Num() <= Material)
+        {
+            Output.SetNum(Material + 1);
+        }
+        return Output[Material];
+    }
+
+    FORCEINLINE int32 AddVertex(FSliceBuffer& Buffer, const FVector3f& Position, const FVector3f& Normal)
+    {
+        FDynamicMeshVertex& Vertex = Buffer.Vertices.AddDefaulted_GetRef();
+        Vertex.Position = Position;
+
+        // There are no UVs, any basis around the normal will do
+        FVector3f TangentX, TangentY;
+        Normal.FindBestAxisVectors(TangentX, TangentY);
+        Vertex.SetTangents(TangentX, TangentY, Normal);
+        return Buffer.Vertices.Num() - 1;
+    }
+
+    /** A, B, C, D go counter clockwise around the outward normal */
+    FORCEINLINE void AddQuad(FSliceBuffer& Buffer, int32 A, int32 B, int32 C, int32 D)
+    {
+        // Same winding as the generated normals: (P1 - P2) ^ (P0 - P2) points outward
+        Buffer.Indices.Append({ (uint32)A, (uint32)C, (uint32)B, (uint32)A, (uint32)D, (uint32)C });
+    }
+
+    FORCEINLINE bool IsSolid(float Density)
+    {
+        return Density > 0.f;
+    }
+
+    FORCEINLINE uint8 GetMaterial(const FSimpleMeshVoxelGrid& Grid, int32 Index)
+    {
+        return Grid.Materials.Num() > 0 ? Grid.Materials[Index] : 0;
+    }
+
+    FORCEINLINE FIntVector AxisVector(int32 Axis)
+    {
+        FIntVector Result(0, 0, 0);
+        Result[Axis] = 1;
+        return Result;
+    }
+
+    /** Sample coordinates to section space, the first inner sample is at the origin */
+    FORCEINLINE FVector3f ToLocal(const FVector3f& SamplePosition, float VoxelSize)
+    {
+        return (SamplePosition - FVector3f(1.f)) * VoxelSize;
+    }
+
+    /**
+     *	Greedy meshing of the faces lying on one plane perpendicular to Axis, between samples Plane - 1 and Plane.
+     *	A face belongs to the chunk of its solid voxel, faces of solid apron voxels are left to the neighbour.
+     */
+    static void MeshGreedyPlane(const FSimpleMeshVoxelGrid& Grid, int32 Axis, int32 Plane, FSliceOutput& Output)
+    {
+        const int32 AxisU = (Axis + 1) % 3;
+        const int32 AxisV = (Axis + 2) % 3;
+        const int32 NumU = Grid.Size[AxisU] - 2;
+        const int32 NumV = Grid.Size[AxisV] - 2;
+        const int32 NumInner = Grid.Size[Axis] - 2;
+
+        // +(slot + 1) for a face looking toward +Axis, -(slot + 1) toward -Axis, 0 for no face
+        TArray<int32, TInlineAllocator<1024>> Mask;
+        Mask.SetNumUninitialized(NumU * NumV);
+
+        FIntVector Sample(0, 0, 0);
+        for (int32 V = 0; V < NumV; V++)
+        {
+            for (int32 U = 0; U < NumU; U++)
+            {
+                Sample[Axis] = Plane - 1;
+                Sample[AxisU] = U + 1;
+                Sample[AxisV] = V + 1;
+                const int32 Behind = Grid.GetIndex(Sample.X, Sample.Y, Sample.Z);
+                Sample[Axis] = Plane;
+                const int32 Front = Grid.GetIndex(Sample.X, Sample.Y, Sample.Z);
+
+                const bool bSolidBehind = IsSolid(Grid.Densities[Behind]);
+                const bool bSolidFront = IsSolid(Grid.Densities[Front]);
+
+                int32 Face = 0;
+                if (bSolidBehind && !bSolidFront && Plane - 1 >= 1)
+                {
+                    Face = GetMaterial(Grid, Behind) + 1;
+                }
+                else if (!bSolidBehind && bSolidFront && Plane <= NumInner)
+                {
+                    Face = -(GetMaterial(Grid, Front) + 1);
+                }
+                Mask[U + V * NumU] = Face;
+            }
+        }
+
+        FVector3f Normal = FVector3f::ZeroVector;
+        for (int32 V = 0; V < NumV; V++)
+        {
+            for (int32 U = 0; U < NumU; U++)
+            {
+                const int32 Face = Mask[U + V * NumU];
+                if (Face == 0)
+                {
+                    continue;
+                }
+
+                // Grow along U, then along V while the whole row matches
+                int32 Width = 1;
+                while (U + Width < NumU && Mask[U + Width + V * NumU] == Face)
+                {
+                    Width++;
+                }
+
+                int32 Height = 1;
+                for (; V + Height < NumV; Height++)
+                {
+                    bool bRowMatches = true;
+                    for (int32 K = 0; K < Width && bRowMatches; K++)
+                    {
+                        bRowMatches = Mask[U + K + (V + Height) * NumU] == Face;
+                    }
+                    if (!bRowMatches)
+                    {
+                        break;
+                    }
+                }
+
+                for (int32 Row = 0; Row < Height; Row++)
+                {
+                    FMemory::Memzero(&Mask[U + (V + Row) * NumU], Width * sizeof(int32));
+                }
+
+                FVector3f Corner(0.f);
+                Corner[Axis] = (float)(Plane - 1);
+                Corner[AxisU] = (float)U;
+                Corner[AxisV] = (float)V;
+                FVector3f DeltaU(0.f);
+                DeltaU[AxisU] = (float)Width;
+                FVector3f DeltaV(0.f);
+                DeltaV[AxisV] = (float)Height;
+
+                Normal = FVector3f::ZeroVector;
+                Normal[Axis] = Face > 0 ? 1.f : -1.f;
+
+                FSliceBuffer& Buffer = GetBuffer(Output, (uint8)(FMath::Abs(Face) - 1));
+                const float VoxelSize = Grid.VoxelSize;
+                const int32 A = AddVertex(Buffer, Corner * VoxelSize, Normal);
+                const int32 B = AddVertex(Buffer, (Corner + DeltaU) * VoxelSize, Normal);
+                const int32 C = AddVertex(Buffer, (Corner + DeltaU + DeltaV) * VoxelSize, Normal);
+                const int32 D = AddVertex(Buffer, (Corner + DeltaV) * VoxelSize, Normal);
+
+                // U ^ V is +Axis
+                if (Face > 0)
+                {
+                    AddQuad(Buffer, A, B, C, D);
+                }
+                else
+                {
+                    AddQuad(Buffer, A, D, C, B);
+                }
+            }
+        }
+    }
+
+    /** Surface nets vertex of a cell (samples Cell .. Cell + 1): mean of the edge crossings, normal from the corner gradient */
+    static bool ComputeCellVertex(const FSimpleMeshVoxelGrid& Grid, const FIntVector& Cell, FVector3f& OutPosition, FVector3f& OutNormal)
+    {
+        float Corners[8];
+        for (int32 CornerIdx = 0; CornerIdx < 8; CornerIdx++)
+        {
+            Corners[CornerIdx] = Grid.Densities[Grid.GetIndex(Cell.X + (CornerIdx & 1), Cell.Y + ((CornerIdx >> 1) & 1), Cell.Z + ((CornerIdx >> 2) & 1))];
+        }
+
+        FVector3f Sum = FVector3f::ZeroVector;
+        int32 NumCrossings = 0;
+        FVector3f Gradient = FVector3f::ZeroVector;
+        for (int32 Axis = 0; Axis < 3; Axis++)
+        {
+            const int32 Bit = 1 << Axis;
+            for (int32 CornerIdx = 0; CornerIdx < 8; CornerIdx++)
+            {
+                if (CornerIdx & Bit)
+                {
+                    continue;
+                }
+
+                const float D0 = Corners[CornerIdx];
+                const float D1 = Corners[CornerIdx | Bit];
+                Gradient[Axis] += D1 - D0;
+
+                if (IsSolid(D0) != IsSolid(D1))
+                {
+                    FVector3f Crossing((float)(CornerIdx & 1), (float)((CornerIdx >> 1) & 1), (float)((CornerIdx >> 2) & 1));
+                    Crossing[Axis] = FMath::Clamp(D0 / (D0 - D1), 0.f, 1.f);
+                    Sum += Crossing;
+                    NumCrossings++;
+                }
+            }
+        }
+
+        if (NumCrossings == 0)
+        {
+            return false;
+        }
+
+        OutPosition = ToLocal(FVector3f(Cell) + Sum / (float)NumCrossings, Grid.VoxelSize);
+
+        // Density grows inward
+        OutNormal = (-Gradient).GetSafeNormal();
+        if (OutNormal.IsNearlyZero())
+        {
+            OutNormal = FVector3f::UpVector;
+        }
+        return true;
+    }
+
+    /** Surface nets quads of every edge starting on the inner samples of layer Z */
+    static void MeshSurfaceNetsLayer(const FSimpleMeshVoxelGrid& Grid, int32 Z, FSliceOutput& Output)
+    {
+        // One vertex per (cell, material) in this layer, neighbouring layers duplicate the shared ones
+        TMap<uint64, int32> CellVertices;
+
+        auto GetCellVertex = [&Grid, &Output, &CellVertices](const FIntVector& Cell, uint8 Material) -> int32
+        {
+            const uint64 Key = ((uint64)Grid.GetIndex(Cell.X, Cell.Y, Cell.Z) << 8) | Material;
+            if (const int32* Found = CellVertices.Find(Key))
+            {
+                return *Found;
+            }
+
+            FVector3f Position, Normal;
+            if (!ComputeCellVertex(Grid, Cell, Position, Normal))
+            {
+                // Cannot happen for a cell around a crossing edge, keeps the quad valid anyway
+                Position = ToLocal(FVector3f(Cell) + FVector3f(0.5f), Grid.VoxelSize);
+                Normal = FVector3f::UpVector;
+            }
+            const int32 VertIdx = AddVertex(GetBuffer(Output, Material), Position, Normal);
+            CellVertices.Add(Key, VertIdx);
+            return VertIdx;
+        };
+
+        for (int32 Y = 1; Y <= Grid.Size.Y - 2; Y++)
+        {
+            for (int32 X = 1; X <= Grid.Size.X - 2; X++)
+            {
+                const FIntVector Sample(X, Y, Z);
+                const int32 SampleIndex = Grid.GetIndex(X, Y, Z);
+                const float Density = Grid.Densities[SampleIndex];
+
+                for (int32 Axis = 0; Axis < 3; Axis++)
+                {
+                    const FIntVector Next = Sample + AxisVector(Axis);
+                    const int32 NextIndex = Grid.GetIndex(Next.X, Next.Y, Next.Z);
+                    const bool bSolid = IsSolid(Density);
+                    if (bSolid == IsSolid(Grid.Densities[NextIndex]))
+                    {
+                        continue;
+                    }
+
+                    const uint8 Material = GetMaterial(Grid, bSolid ? SampleIndex : NextIndex);
+                    const FIntVector StepU = AxisVector((Axis + 1) % 3);
+                    const FIntVector StepV = AxisVector((Axis + 2) % 3);
+
+                    // The four cells around the edge, counter clockwise around +Axis
+                    const int32 A = GetCellVertex(Sample - StepU - StepV, Material);
+                    const int32 B = GetCellVertex(Sample - StepV, Material);
+                    const int32 C = GetCellVertex(Sample, Material);
+                    const int32 D = GetCellVertex(Sample - StepU, Material);
+
+                    FSliceBuffer& Buffer = GetBuffer(Output, Material);
+                    if (bSolid)
+                    {
+                        AddQuad(Buffer, A, B, C, D);
+                    }
+                    else
+                    {
+                        AddQuad(Buffer, A, D, C, B);
+                    }
+                }
+            }
+        }
+    }
+
+    /** Concatenate the slices in order, so the result does not depend on thread timing */
+    static void MergeSlices(TArray<FSliceOutput>& Slices, TArray<FSimpleMeshSection>& OutSections)
+    {
+        int32 NumMaterials = 0;
+        for (const FSliceOutput& Slice : Slices)
+        {
+            NumMaterials = FMath::Max(NumMaterials, Slice.Num());
+        }
+
+        OutSections.Reset();
+        OutSections.SetNum(NumMaterials);
+        for (int32 Material = 0; Material < NumMaterials; Material++)
+        {
+            FSimpleMeshSection& Section = OutSections[Material];
+            Section.MaterialIndex = Material;
+
+            int32 NumVertices = 0;
+            int32 NumIndices = 0;
+            for (const FSliceOutput& Slice : Slices)
+            {
+                if (Slice.IsValidIndex(Material))
+                {
+                    NumVertices += Slice[Material].Vertices.Num();
+                    NumIndices += Slice[Material].Indices.Num();
+                }
+            }
+
+            Section.VertexBuffer.Reserve(NumVertices);
+            Section.IndexBuffer.Reserve(NumIndices);
+            for (FSliceOutput& Slice : Slices)
+            {
+                if (!Slice.IsValidIndex(Material))
+                {
+                    continue;
+                }
+
+                const uint32 BaseVertex = (uint32)Section.VertexBuffer.Num();
+                for (const FDynamicMeshVertex& Vertex : Slice[Material].Vertices)
+                {
+                    Section.SectionLocalBox += FVector(Vertex.Position);
+                }
+                Section.VertexBuffer.Append(Slice[Material].Vertices);
+                for (uint32 Index : Slice[Material].Indices)
+                {
+                    Section.IndexBuffer.Add(BaseVertex + Index);
+                }
+                Slice[Material] = FSliceBuffer();
+            }
+        }
+    }
+}
+
+using namespace SimpleMeshVoxelPrivate;
+
+void SimpleMeshVoxel::MeshGrid(const FSimpleMeshVoxelGrid& Grid, ESimpleMeshVoxelMode Mode, TArray<FSimpleMeshSection>& OutSections)
+{
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_MeshVoxelGrid);
+
+    OutSections.Reset();
+    if (!Grid.IsValid())
+    {
+        return;
+    }
+
+    TArray<FSliceOutput> Slices;
+    if (Mode == ESimpleMeshVoxelMode::Greedy)
+    {
+        // Every plane of every axis: Size - 1 planes per axis, from between the apron and the first inner sample to the opposite side
+        const int32 NumPlanes[3] = { Grid.Size.X - 1, Grid.Size.Y - 1, Grid.Size.Z - 1 };
+        Slices.SetNum(NumPlanes[0] + NumPlanes[1] + NumPlanes[2]);
+        ParallelFor(Slices.Num(), [&](int32 SliceIdx)
+        {
+            int32 Axis = 0;
+            int32 Plane = SliceIdx;
+            while (Plane >= NumPlanes[Axis])
+            {
+                Plane -= NumPlanes[Axis++];
+            }
+            MeshGreedyPlane(Grid, Axis, Plane + 1, Slices[SliceIdx]);
+        });
+    }
+    else
+    {
+        Slices.SetNum(Grid.Size.Z - 2);
+        ParallelFor(Slices.Num(), [&](int32 SliceIdx)
+        {
+            MeshSurfaceNetsLayer(Grid, SliceIdx + 1, Slices[SliceIdx]);
+        });
+    }
+
+    MergeSlices(Slices, OutSections);
+}
+
+void SimpleMeshVoxel::MeshGrids(TConstArrayView<const FSimpleMeshVoxelGrid*> Grids, ESimpleMeshVoxelMode Mode, TArray<TArray<FSimpleMeshSection>>& OutSections)
+{
+    OutSections.Reset();
+    OutSections.SetNum(Grids.Num());
+
+    // The slices of each chunk are parallel too, the task graph balances both levels
+    ParallelFor(Grids.Num(), [&](int32 GridIdx)
+    {
+        if (Grids[GridIdx])
+        {
+            MeshGrid(*Grids[GridIdx], Mode, OutSections[GridIdx]);
+        }
+    });
+}
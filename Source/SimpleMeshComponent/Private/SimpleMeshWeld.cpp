@@ -0,0 +1,172 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHWELD---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHWELD---------//
+
+#include "SimpleMeshWeld.h"
+#include "SimpleMeshComponent.h"
+#include "Algo/BinarySearch.h"
+#include "Algo/Sort.h"
+#include "Async/ParallelFor.h"
+
+DECLARE_CYCLE_STAT(TEXT("Weld Section Vertices"), STAT_SimpleMesh_Weld, STATGROUP_SimpleMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Welded Vertices"), STAT_SimpleMesh_WeldedVertices, STATGROUP_SimpleMesh);
+
+namespace SimpleMeshWeldPrivate
+{
+    /** Below this many vertices the passes run on the calling thread */
+    static constexpr int32 WeldBlockSize = 1024;
+
+    /** Smallest cell, keeps the cell coordinates inside int32 when the tolerance is 0 */
+    static constexpr float MinCellSize = 1.e-3f;
+
+    FORCEINLINE FIntVector GetCell(const FVector3f& Position, float InvCellSize)
+    {
+        return FIntVector(
+            (int32)FMath::Clamp(FMath::FloorToDouble(Position.X * InvCellSize), (double)MIN_int32, (double)MAX_int32),
+            (int32)FMath::Clamp(FMath::FloorToDouble(Position.Y * InvCellSize), (double)MIN_int32, (double)MAX_int32),
+            (int32)FMath::Clamp(FMath::FloorToDouble(Position.Z * InvCellSize), (double)MIN_int32, (double)MAX_int32));
+    }
+
+    /** Different cells may share a key, candidates are always checked by distance */
+    FORCEINLINE uint64 GetCellKey(const FIntVector& Cell)
+    {
+        return ((uint64)(uint32)Cell.X * 73856093ull) ^ ((uint64)(uint32)Cell.Y * 19349663ull) ^ ((uint64)(uint32)Cell.Z * 83492791ull);
+    }
+
+    struct FCellEntry
+    {
+        uint64 Key;
+        int32 Vertex;
+
+        bool operator<(const FCellEntry& Other) const
+        {
+            return Key < Other.Key || (Key == Other.Key && Vertex < Other.Vertex);
+        }
+    };
+}
+
+using namespace SimpleMeshWeldPrivate;
+
+int32 SimpleMeshWeld::WeldSectionVertices(FSimpleMeshSection& Section, float Tolerance)
+{
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_Weld);
+
+    const int32 NumVertices = Section.VertexBuffer.Num();
+    if (NumVertices < 2)
+    {
+        return 0;
+    }
+
+    Tolerance = FMath::Max(Tolerance, 0.f);
+    const float ToleranceSquared = FMath::Square(Tolerance);
+    const float InvCellSize = 1.f / FMath::Max(Tolerance, MinCellSize);
+    const EParallelForFlags Flags = NumVertices < WeldBlockSize ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None;
+
+    // Spatial hash: vertices sorted by cell key, a cell is a run of equal keys
+    TArray<FCellEntry> Entries;
+    Entries.SetNumUninitialized(NumVertices);
+    ParallelFor(NumVertices, [&](int32 VertIdx)
+    {
+        Entries[VertIdx] = { GetCellKey(GetCell(Section.VertexBuffer[VertIdx].Position, InvCellSize)), VertIdx };
+    }, Flags);
+    Algo::Sort(Entries);
+
+    // The cell is at least the tolerance, so candidates are in the 27 cells around the vertex
+    TArray<int32> Remap;
+    Remap.SetNumUninitialized(NumVertices);
+    ParallelFor(NumVertices, [&](int32 VertIdx)
+    {
+        const FVector3f& Position = Section.VertexBuffer[VertIdx].Position;
+        const FIntVector Cell = GetCell(Position, InvCellSize);
+        int32 Target = VertIdx;
+
+        for (int32 Z = -1; Z <= 1; Z++)
+        {
+            for (int32 Y = -1; Y <= 1; Y++)
+            {
+                for (int32 X = -1; X <= 1; X++)
+                {
+                    const uint64 Key = GetCellKey(Cell + FIntVector(X, Y, Z));
+                    int32 EntryIdx = Algo::LowerBoundBy(Entries, Key, &FCellEntry::Key);
+
+                    // Entries of a cell are sorted by vertex, stop at the first one not lower than the current best
+                    for (; EntryIdx < Entries.Num() && Entries[EntryIdx].Key == Key && Entries[EntryIdx].Vertex < Target; EntryIdx++)
+                    {
+                        const int32 Other = Entries[EntryIdx].Vertex;
+                        if (FVector3f::DistSquared(Position, Section.VertexBuffer[Other].Position) <= ToleranceSquared)
+                        {
+                            Target = Other;
+                            break;
+                        }
+                    }
+                }
+            }
+        }
+
+        Remap[VertIdx] = Target;
+    }, Flags);
+
+    // Targets always have a lower index, so one forward pass resolves chains and numbers the kept vertices
+    TArray<int32> NewIndices;
+    NewIndices.SetNumUninitialized(NumVertices);
+    int32 NumKept = 0;
+    for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+    {
+        if (Remap[VertIdx] == VertIdx)
+        {
+            NewIndices[VertIdx] = NumKept++;
+        }
+        else
+        {
+            Remap[VertIdx] = Remap[Remap[VertIdx]];
+            NewIndices[VertIdx] = NewIndices[Remap[VertIdx]];
+        }
+    }
+
+    const int32 NumRemoved = NumVertices - NumKept;
+    if (NumRemoved == 0)
+    {
+        return 0;
+    }
+
+    // Compact the vertices in place, a kept vertex never moves to a higher index
+    Section.SectionLocalBox.Init();
+    for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+    {
+        if (Remap[VertIdx] == VertIdx)
+        {
+            Section.VertexBuffer[NewIndices[VertIdx]] = Section.VertexBuffer[VertIdx];
+            Section.SectionLocalBox += FVector(Section.VertexBuffer[VertIdx].Position);
+        }
+    }
+    Section.VertexBuffer.SetNum(NumKept, false);
+
+    // Remap the indices, then drop the triangles that lost a corner
+    TArray<uint32>& Indices = Section.IndexBuffer;
+    ParallelFor(Indices.Num(), [&](int32 Idx)
+    {
+        if (Indices[Idx] < (uint32)NumVertices)
+        {
+            Indices[Idx] = (uint32)NewIndices[Indices[Idx]];
+        }
+    }, Indices.Num() < WeldBlockSize ? EParallelForFlags::ForceSingleThread : EParallelForFlags::None);
+
+    int32 NumIndices = 0;
+    for (int32 Idx = 0; Idx + 2 < Indices.Num(); Idx += 3)
+    {
+        const uint32 A = Indices[Idx], B = Indices[Idx + 1], C = Indices[Idx + 2];
+        if (A != B && B != C && C != A)
+        {
+            Indices[NumIndices++] = A;
+            Indices[NumIndices++] = B;
+            Indices[NumIndices++] = C;
+        }
+    }
+    Indices.SetNum(NumIndices, false);
+
+    INC_DWORD_STAT_BY(STAT_SimpleMesh_WeldedVertices, NumRemoved);
+    return NumRemoved;
+}
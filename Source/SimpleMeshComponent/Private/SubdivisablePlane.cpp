@@ -8,6 +8,119 @@
 #include "SubdivisablePlane.h"
 #include "SimpleMeshComponent.h"
 #include "DynamicMeshBuilder.h"
+#include "Async/Async.h"
+#include "Engine/World.h"
+#include "GameFramework/PlayerController.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogSubdivisablePlane, Log, All);
+
+DECLARE_CYCLE_STAT(TEXT("Plane LOD Selection"), STAT_SimpleMesh_PlaneLODSelection, STATGROUP_SimpleMesh);
+DECLARE_CYCLE_STAT(TEXT("Plane LOD Tile Build"), STAT_SimpleMesh_PlaneLODTileBuild, STATGROUP_SimpleMesh);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Plane LOD Tiles Built"), STAT_SimpleMesh_PlaneLODTilesBuilt, STATGROUP_SimpleMesh);
+
+namespace SubdivisablePlanePrivate
+{
+    enum ETileEdge : uint8
+    {
+        EdgeMinX = 1 << 0,
+        EdgeMaxX = 1 << 1,
+        EdgeMinY = 1 << 2,
+        EdgeMaxY = 1 << 3,
+    };
+
+    FORCEINLINE int32 GetTileLevel(uint64 TileKey) { return (int32)(TileKey >> 48); }
+    FORCEINLINE int32 GetTileX(uint64 TileKey) { return (int32)((TileKey >> 24) & 0xFFFFFF); }
+    FORCEINLINE int32 GetTileY(uint64 TileKey) { return (int32)(TileKey & 0xFFFFFF); }
+
+    /**
+     *	Grid of Resolution x Resolution quads over one tile. On the stitched edges every odd vertex is collapsed onto
+     *	the previous one, which leaves the vertices of the coarser neighbor only, and the collapsed triangles are dropped.
+     */
+    static FSimpleMeshSection BuildTile(const FVector2D& PlaneSize, int32 Resolution, int32 Level, int32 TileX, int32 TileY, uint8 EdgeMask, const TFunction<float(double, double)>& HeightSampler)
+    {
+        SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_PlaneLODTileBuild);
+
+        const double NumTiles = (double)(1 << Level);
+        const FVector2D TileSize = PlaneSize / NumTiles;
+        const FVector2D TileOrigin(TileX * TileSize.X, TileY * TileSize.Y);
+        const FVector2D Step = TileSize / Resolution;
+        const int32 RowSize = Resolution + 1;
+
+        auto SampleHeight = [&HeightSampler](double X, double Y)
+        {
+            return HeightSampler ? HeightSampler(X, Y) : 0.f;
+        };
+
+        FSimpleMeshSection Section;
+        Section.VertexBuffer.SetNum(RowSize * RowSize);
+        for (int32 Y = 0; Y <= Resolution; Y++)
+        {
+            for (int32 X = 0; X <= Resolution; X++)
+            {
+                const double PosX = TileOrigin.X + X * Step.X;
+                const double PosY = TileOrigin.Y + Y * Step.Y;
+
+                // Normals from the height field rather than the triangles, so they match across tiles of any LOD
+                FVector3f Normal = FVector3f::UpVector;
+                if (HeightSampler)
+                {
+                    const float SlopeX = (float)((SampleHeight(PosX + Step.X, PosY) - SampleHeight(PosX - Step.X, PosY)) / (2.0 * Step.X));
+                    const float SlopeY = (float)((SampleHeight(PosX, PosY + Step.Y) - SampleHeight(PosX, PosY - Step.Y)) / (2.0 * Step.Y));
+                    Normal = FVector3f(-SlopeX, -SlopeY, 1.f).GetSafeNormal();
+                }
+                const FVector3f TangentX = (FVector3f::ForwardVector - Normal * Normal.X).GetSafeNormal();
+
+                FDynamicMeshVertex& Vertex = Section.VertexBuffer[Y * RowSize + X];
+                Vertex.Position = FVector3f((float)PosX, (float)PosY, SampleHeight(PosX, PosY));
+                Vertex.TextureCoordinate[0] = FVector2f((float)(PosX / PlaneSize.X), (float)(PosY / PlaneSize.Y));
+                Vertex.Color = FColor::White;
+                Vertex.SetTangents(TangentX, Normal ^ TangentX, Normal);
+                Section.SectionLocalBox += FVector(Vertex.Position);
+            }
+        }
+
+        TArray<int32> Remap;
+        Remap.SetNumUninitialized(RowSize * RowSize);
+        for (int32 VertIdx = 0; VertIdx < Remap.Num(); VertIdx++)
+        {
+            Remap[VertIdx] = VertIdx;
+        }
+        for (int32 EdgeIdx = 1; EdgeIdx < Resolution; EdgeIdx += 2)
+        {
+            if (EdgeMask & EdgeMinX) { Remap[EdgeIdx * RowSize] = (EdgeIdx - 1) * RowSize; }
+            if (EdgeMask & EdgeMaxX) { Remap[EdgeIdx * RowSize + Resolution] = (EdgeIdx - 1) * RowSize + Resolution; }
+            if (EdgeMask & EdgeMinY) { Remap[EdgeIdx] = EdgeIdx - 1; }
+            if (EdgeMask & EdgeMaxY) { Remap[Resolution * RowSize + EdgeIdx] = Resolution * RowSize + EdgeIdx - 1; }
+        }
+
+        // Same triangles as the uniform plane
+        Section.IndexBuffer.Reserve(Resolution * Resolution * 6);
+        auto AddTriangle = [&Section, &Remap](int32 A, int32 B, int32 C)
+        {
+            A = Remap[A];
+            B = Remap[B];
+            C = Remap[C];
+            if (A != B && B != C && C != A)
+            {
+                Section.IndexBuffer.Append({ (uint32)A, (uint32)B, (uint32)C });
+            }
+        };
+        for (int32 Y = 0; Y < Resolution; Y++)
+        {
+            for (int32 X = 0; X < Resolution; X++)
+            {
+                const int32 Index = X + RowSize * Y;
+                AddTriangle(Index, Index + RowSize, Index + 1);
+                AddTriangle(Index + 1, Index + RowSize, Index + RowSize + 1);
+            }
+        }
+
+        INC_DWORD_STAT(STAT_SimpleMesh_PlaneLODTilesBuilt);
+        return Section;
+    }
+}
+
+using namespace SubdivisablePlanePrivate;
 
 
 ASubdivisablePlane::ASubdivisablePlane()
@@ -21,18 +134,15 @@ ASubdivisablePlane::ASubdivisablePlane()
     SimpleMeshComponent = CreateDefaultSubobject<USimpleMeshComponent>(TEXT("SimpleMeshComponent"));
     SimpleMeshComponent->SetupAttachment(Root);
     SimpleMeshComponent->SetMobility(EComponentMobility::Static);
+    SimpleMeshComponent->bSerializeMeshSections = true;
     
     // Enable collision
     SimpleMeshComponent->SetCollisionEnabled(ECollisionEnabled::QueryAndPhysics);
     SimpleMeshComponent->SetCollisionResponseToAllChannels(ECR_Block);
-    UMaterialInterface* Material1 = MaterialSlot1;
-    UMaterialInterface* Material2 = MaterialSlot2;
 
-   
-        Material1 = LoadObject<UMaterialInterface>(nullptr, TEXT("MaterialInterface'/VoxelScape/Materials/CubesTypes/MI_Grass.MI_Grass'"));
-   
-        Material2 = LoadObject<UMaterialInterface>(nullptr, TEXT("MaterialInterface'/VoxelScape/Materials/CubesTypes/MI_Dirt.MI_Dirt'"));
-    
+    // Resolved when first used, a project without them just gets the default material
+    DefaultMaterial1 = TSoftObjectPtr<UMaterialInterface>(FSoftObjectPath(TEXT("/VoxelScape/Materials/CubesTypes/MI_Grass.MI_Grass")));
+    DefaultMaterial2 = TSoftObjectPtr<UMaterialInterface>(FSoftObjectPath(TEXT("/VoxelScape/Materials/CubesTypes/MI_Dirt.MI_Dirt")));
 }
 
 void ASubdivisablePlane::OnConstruction(const FTransform& Transform)
@@ -44,24 +154,54 @@ void ASubdivisablePlane::OnConstruction(const FTransform& Transform)
 void ASubdivisablePlane::BeginPlay()
 {
     Super::BeginPlay();
-    InitializePlaneGeometry();
+
+    // Geometry is saved with the component, only build it if it was not loaded or constructed already.
+    // Quadtree tiles are not, they start over around the player.
+    if (bUseQuadtreeLOD || SimpleMeshComponent->GetNumSections() == 0)
+    {
+        InitializePlaneGeometry();
+    }
 }
 
 void ASubdivisablePlane::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
+
+    // One batch at a time, the next selection starts from the tiles it put on screen
+    if (!bUseQuadtreeLOD || NumPendingTiles > 0)
+    {
+        return;
+    }
+
+    const FVector LocalViewLocation = GetLocalViewLocation();
+    if (bLODTilesDirty || FVector::DistSquared(LocalViewLocation, LastLODViewLocation) > FMath::Square(LODUpdateDistance))
+    {
+        UpdateLODTiles(LocalViewLocation);
+    }
 }
 
 void ASubdivisablePlane::InitializePlaneGeometry()
 {
     double StartTime = FPlatformTime::Seconds();
+
+    if (bUseQuadtreeLOD)
+    {
+        ResetLODTiles();
+        UpdateLODTiles(GetLocalViewLocation());
+        return;
+    }
+    if (!LODTiles.IsEmpty() || NumPendingTiles > 0)
+    {
+        ResetLODTiles();
+    }
+
     if (NumDivisionsX < 1 || NumDivisionsY < 1) return;
 
     TArray<FVector> Vertices; // Modification pour utiliser FVector directement
     TArray<int32> Indices;
 
-    float SizeX = 100.0f;
-    float SizeY = 100.0f;
+    float SizeX = PlaneSize.X;
+    float SizeY = PlaneSize.Y;
     float DeltaX = SizeX / NumDivisionsX;
     float DeltaY = SizeY / NumDivisionsY;
 
@@ -91,17 +231,8 @@ void ASubdivisablePlane::InitializePlaneGeometry()
         }
     }
 
-    UMaterialInterface* Material1 = MaterialSlot1;
-    UMaterialInterface* Material2 = MaterialSlot2;
-
-    if (!Material1)
-    {
-        Material1 = LoadObject<UMaterialInterface>(nullptr, TEXT("MaterialInterface'/VoxelScape/Materials/CubesTypes/MI_Grass.MI_Grass'"));
-    }
-    if (!Material1)
-    {
-        Material2 = LoadObject<UMaterialInterface>(nullptr, TEXT("MaterialInterface'/VoxelScape/Materials/CubesTypes/MI_Dirt.MI_Dirt'"));
-    }
+    UMaterialInterface* Material1 = ResolveMaterial(MaterialSlot1, DefaultMaterial1);
+    UMaterialInterface* Material2 = ResolveMaterial(MaterialSlot2, DefaultMaterial2);
 
     SimpleMeshComponent->CreateMeshSection(0, Vertices, Indices, Material1, true, true); // Modifi pour prendre FVector
     SimpleMeshComponent ->SetMaterial(0, Material1);
@@ -111,4 +242,293 @@ void ASubdivisablePlane::InitializePlaneGeometry()
     double ElapsedTimeMs = (EndTime - StartTime) * 1000.0;
 }
 
-// SimpleMesh.cpp
\ No newline at end of file
+void ASubdivisablePlane::SelectLODTiles(const FVector& LocalViewLocation, TMap<uint64, uint8>& OutTiles) const
+{
+    SCOPE_CYCLE_COUNTER(STAT_SimpleMesh_PlaneLODSelection);
+
+    const int32 MaxLevel = FMath::Clamp(MaxLODLevel, 0, 16);
+    const double LargestSide = FMath::Max(PlaneSize.X, PlaneSize.Y);
+    TSet<uint64> SplitTiles;
+
+    // Distance pass, top down: a tile is split while the view is close compared to its size
+    TArray<uint64> Stack = { MakeTileKey(0, 0, 0) };
+    while (Stack.Num() > 0)
+    {
+        const uint64 TileKey = Stack.Pop(false);
+        const int32 Level = GetTileLevel(TileKey);
+        if (Level >= MaxLevel)
+        {
+            continue;
+        }
+
+        const FVector2D TileSize = PlaneSize / (double)(1 << Level);
+        const FBox TileBox(FVector(GetTileX(TileKey) * TileSize.X, GetTileY(TileKey) * TileSize.Y, 0.0),
+            FVector((GetTileX(TileKey) + 1) * TileSize.X, (GetTileY(TileKey) + 1) * TileSize.Y, 0.0));
+        if (TileBox.ComputeSquaredDistanceToPoint(LocalViewLocation) < FMath::Square(LargestSide / (1 << Level) * LODDistanceFactor))
+        {
+            SplitTiles.Add(TileKey);
+            for (int32 Child = 0; Child < 4; Child++)
+            {
+                Stack.Add(MakeTileKey(Level + 1, GetTileX(TileKey) * 2 + (Child & 1), GetTileY(TileKey) * 2 + (Child >> 1)));
+            }
+        }
+    }
+
+    // Leaf holding a point of the unit square
+    auto FindLeaf = [&SplitTiles](double U, double V)
+    {
+        uint64 TileKey = MakeTileKey(0, 0, 0);
+        while (SplitTiles.Contains(TileKey))
+        {
+            const int32 Level = GetTileLevel(TileKey) + 1;
+            const double NumTiles = (double)(1 << Level);
+            TileKey = MakeTileKey(Level, FMath::Clamp((int32)(U * NumTiles), 0, (1 << Level) - 1), FMath::Clamp((int32)(V * NumTiles), 0, (1 << Level) - 1));
+        }
+        return TileKey;
+    };
+
+    auto GatherLeaves = [&SplitTiles](TArray<uint64>& OutLeaves)
+    {
+        OutLeaves.Reset();
+        TArray<uint64> Pending = { MakeTileKey(0, 0, 0) };
+        while (Pending.Num() > 0)
+        {
+            const uint64 TileKey = Pending.Pop(false);
+            if (!SplitTiles.Contains(TileKey))
+            {
+                OutLeaves.Add(TileKey);
+                continue;
+            }
+
+            const int32 Level = GetTileLevel(TileKey);
+            for (int32 Child = 0; Child < 4; Child++)
+            {
+                Pending.Add(MakeTileKey(Level + 1, GetTileX(TileKey) * 2 + (Child & 1), GetTileY(TileKey) * 2 + (Child >> 1)));
+            }
+        }
+    };
+
+    // Point just across each edge of a leaf, in the unit square: -X, +X, -Y, +Y
+    const double Epsilon = 0.25 / (double)(1 << MaxLevel);
+    auto GetNeighborPoint = [Epsilon](uint64 TileKey, int32 Edge, double& OutU, double& OutV)
+    {
+        const double TileSize = 1.0 / (double)(1 << GetTileLevel(TileKey));
+        const double MinU = GetTileX(TileKey) * TileSize;
+        const double MinV = GetTileY(TileKey) * TileSize;
+        OutU = Edge == 0 ? MinU - Epsilon : (Edge == 1 ? MinU + TileSize + Epsilon : MinU + TileSize * 0.5);
+        OutV = Edge == 2 ? MinV - Epsilon : (Edge == 3 ? MinV + TileSize + Epsilon : MinV + TileSize * 0.5);
+        return OutU >= 0.0 && OutU < 1.0 && OutV >= 0.0 && OutV < 1.0;
+    };
+
+    // Neighbors are kept within one level, the seams between them can then be stitched by collapsing every other vertex
+    TArray<uint64> Leaves;
+    bool bChanged = true;
+    while (bChanged)
+    {
+        bChanged = false;
+        GatherLeaves(Leaves);
+        for (const uint64 TileKey : Leaves)
+        {
+            for (int32 Edge = 0; Edge < 4; Edge++)
+            {
+                double U, V;
+                if (!GetNeighborPoint(TileKey, Edge, U, V))
+                {
+                    continue;
+                }
+
+                const uint64 NeighborKey = FindLeaf(U, V);
+                if (GetTileLevel(NeighborKey) < GetTileLevel(TileKey) - 1)
+                {
+                    SplitTiles.Add(NeighborKey);
+                    bChanged = true;
+                }
+            }
+        }
+    }
+
+    OutTiles.Reset();
+    OutTiles.Reserve(Leaves.Num());
+    for (const uint64 TileKey : Leaves)
+    {
+        uint8 EdgeMask = 0;
+        for (int32 Edge = 0; Edge < 4; Edge++)
+        {
+            double U, V;
+            if (GetNeighborPoint(TileKey, Edge, U, V) && GetTileLevel(FindLeaf(U, V)) < GetTileLevel(TileKey))
+            {
+                EdgeMask |= 1 << Edge;
+            }
+        }
+        OutTiles.Add(TileKey, EdgeMask);
+    }
+}
+
+void ASubdivisablePlane::UpdateLODTiles(const FVector& LocalViewLocation)
+{
+    LastLODViewLocation = LocalViewLocation;
+    bLODTilesDirty = false;
+
+    TMap<uint64, uint8> Selection;
+    SelectLODTiles(LocalViewLocation, Selection);
+
+    // Tiles with the same LOD and the same seams keep their section
+    TArray<TPair<uint64, uint8>> ToBuild;
+    for (const TPair<uint64, uint8>& Tile : Selection)
+    {
+        const FLODTile* Existing = LODTiles.Find(Tile.Key);
+        if (!Existing || Existing->EdgeMask != Tile.Value)
+        {
+            ToBuild.Add(Tile);
+        }
+    }
+
+    if (ToBuild.Num() == 0 && Selection.Num() == LODTiles.Num())
+    {
+        return;
+    }
+
+    LODBatchSerial++;
+    BatchSelection = MoveTemp(Selection);
+    BatchTiles.Reset();
+    NumPendingTiles = ToBuild.Num();
+
+    const int32 Resolution = FMath::Clamp(TileResolution, 2, 254) & ~1;
+    for (const TPair<uint64, uint8>& Tile : ToBuild)
+    {
+        Async(EAsyncExecution::ThreadPool, [WeakThis = TWeakObjectPtr<ASubdivisablePlane>(this), Serial = LODBatchSerial, TileKey = Tile.Key, EdgeMask = Tile.Value,
+            PlaneSize = PlaneSize, Resolution, HeightSampler = MakeHeightSampler()]()
+        {
+            FSimpleMeshSection Section = BuildTile(PlaneSize, Resolution, GetTileLevel(TileKey), GetTileX(TileKey), GetTileY(TileKey), EdgeMask, HeightSampler);
+
+            AsyncTask(ENamedThreads::GameThread, [WeakThis, Serial, TileKey, EdgeMask, Section = MoveTemp(Section)]() mutable
+            {
+                if (ASubdivisablePlane* Plane = WeakThis.Get())
+                {
+                    Plane->FinishLODTile(Serial, TileKey, EdgeMask, MoveTemp(Section));
+                }
+            });
+        });
+    }
+
+    // Only merges, nothing to wait for
+    if (NumPendingTiles == 0)
+    {
+        ApplyLODBatch();
+    }
+}
+
+void ASubdivisablePlane::FinishLODTile(uint32 Serial, uint64 TileKey, uint8 EdgeMask, FSimpleMeshSection&& Section)
+{
+    // The tiles were reset meanwhile
+    if (Serial != LODBatchSerial || NumPendingTiles <= 0)
+    {
+        return;
+    }
+
+    FLODTile& Tile = BatchTiles.Add(TileKey);
+    Tile.EdgeMask = EdgeMask;
+    Tile.Component = AcquireTileComponent();
+    Tile.Component->CommitMeshSection(0, MoveTemp(Section), ResolveMaterial(MaterialSlot1, DefaultMaterial1), false, bTileCollision);
+
+    if (--NumPendingTiles == 0)
+    {
+        ApplyLODBatch();
+    }
+}
+
+void ASubdivisablePlane::ApplyLODBatch()
+{
+    const int32 NumRebuilt = BatchTiles.Num();
+
+    // New tiles first, then the ones they replace go, within the same frame
+    for (const TPair<uint64, FLODTile>& Tile : BatchTiles)
+    {
+        Tile.Value.Component->SetSectionVisible(0, true);
+    }
+
+    for (auto It = LODTiles.CreateIterator(); It; ++It)
+    {
+        if (!BatchSelection.Contains(It.Key()) || BatchTiles.Contains(It.Key()))
+        {
+            ReleaseTileComponent(It.Value().Component);
+            It.RemoveCurrent();
+        }
+    }
+    LODTiles.Append(MoveTemp(BatchTiles));
+
+    UE_LOG(LogSubdivisablePlane, Verbose, TEXT("%s: %d tiles, %d rebuilt"), *GetName(), LODTiles.Num(), NumRebuilt);
+    BatchSelection.Reset();
+    BatchTiles.Reset();
+}
+
+void ASubdivisablePlane::ResetLODTiles()
+{
+    // Builds in flight are dropped by the serial
+    LODBatchSerial++;
+    NumPendingTiles = 0;
+    BatchSelection.Reset();
+    for (const TPair<uint64, FLODTile>& Tile : BatchTiles)
+    {
+        ReleaseTileComponent(Tile.Value.Component);
+    }
+    BatchTiles.Reset();
+    for (const TPair<uint64, FLODTile>& Tile : LODTiles)
+    {
+        ReleaseTileComponent(Tile.Value.Component);
+    }
+    LODTiles.Reset();
+    bLODTilesDirty = true;
+    SimpleMeshComponent->ClearAllMeshSections();
+}
+
+USimpleMeshComponent* ASubdivisablePlane::AcquireTileComponent()
+{
+    USimpleMeshComponent* Component = nullptr;
+    if (TileComponentPool.Num() > 0)
+    {
+        Component = TileComponentPool.Pop(false);
+    }
+    else
+    {
+        Component = NewObject<USimpleMeshComponent>(this, NAME_None, RF_Transient);
+        Component->SetMobility(SimpleMeshComponent->Mobility);
+        Component->SetupAttachment(SimpleMeshComponent);
+        Component->SetCollisionObjectType(SimpleMeshComponent->GetCollisionObjectType());
+        Component->SetCollisionEnabled(SimpleMeshComponent->GetCollisionEnabled());
+        Component->SetCollisionResponseToChannels(SimpleMeshComponent->GetCollisionResponseToChannels());
+        Component->RegisterComponent();
+    }
+
+    TileComponents.Add(Component);
+    return Component;
+}
+
+void ASubdivisablePlane::ReleaseTileComponent(USimpleMeshComponent* Component)
+{
+    // Its section keeps its memory for the next tile
+    Component->ClearAllMeshSections();
+    TileComponents.RemoveSingleSwap(Component);
+    TileComponentPool.Add(Component);
+}
+
+FVector ASubdivisablePlane::GetLocalViewLocation() const
+{
+    const UWorld* World = GetWorld();
+    const APlayerController* PlayerController = World ? World->GetFirstPlayerController() : nullptr;
+    if (!PlayerController)
+    {
+        return FVector(PlaneSize * 0.5, 0.0);
+    }
+
+    FVector ViewLocation;
+    FRotator ViewRotation;
+    PlayerController->GetPlayerViewPoint(ViewLocation, ViewRotation);
+    return SimpleMeshComponent->GetComponentTransform().InverseTransformPosition(ViewLocation);
+}
+
+UMaterialInterface* ASubdivisablePlane::ResolveMaterial(UMaterialInterface* SlotMaterial, const TSoftObjectPtr<UMaterialInterface>& DefaultMaterial)
+{
+    // The soft pointer keeps the loaded material, only the first call loads it
+    return SlotMaterial ? SlotMaterial : DefaultMaterial.LoadSynchronous();
+}
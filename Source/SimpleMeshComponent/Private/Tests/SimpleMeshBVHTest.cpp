@@ -0,0 +1,139 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHBVHTEST---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHBVHTEST---------//
+
+#include "SimpleMeshBVH.h"
+#include "SimpleMeshTestWorld.h"
+#include "DynamicMeshBuilder.h"
+#include "Math/RandomStream.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SimpleMeshBVHTest
+{
+    /** Closest hit by testing every triangle */
+    static bool RaycastBruteForce(TConstArrayView<FDynamicMeshVertex> Vertices, TConstArrayView<uint32> Indices, const FVector& Start, const FVector& End, double& OutDistance)
+    {
+        OutDistance = TNumericLimits<double>::Max();
+        for (int32 TriIdx = 0; TriIdx < Indices.Num() / 3; TriIdx++)
+        {
+            FVector Point, Normal;
+            if (FMath::SegmentTriangleIntersection(Start, End, FVector(Vertices[Indices[TriIdx * 3 + 0]].Position),
+                FVector(Vertices[Indices[TriIdx * 3 + 1]].Position), FVector(Vertices[Indices[TriIdx * 3 + 2]].Position), Point, Normal))
+            {
+                OutDistance = FMath::Min(OutDistance, (Point - Start).Size());
+            }
+        }
+        return OutDistance < TNumericLimits<double>::Max();
+    }
+
+    /** Compare BVH raycasts and overlaps with a brute force pass over the triangles, returns the number of mismatches */
+    static int32 CompareWithBruteForce(const FSimpleMeshBVH& BVH, TConstArrayView<FDynamicMeshVertex> Vertices, TConstArrayView<uint32> Indices, const FBox3f& Bounds, int32 NumQueries)
+    {
+        FRandomStream Random(0x5EED);
+        const float Radius = Bounds.GetExtent().Size() * 2.f;
+        int32 NumMismatches = 0;
+
+        for (int32 QueryIdx = 0; QueryIdx < NumQueries; QueryIdx++)
+        {
+            const FVector Target = Random.RandPointInBox(FBox(Bounds));
+            const FVector Start = Target - Random.GetUnitVector() * Radius;
+            const FVector End = Start + (Target - Start) * 2.0;
+            const double Length = (End - Start).Size();
+
+            double ExpectedDistance;
+            const bool bExpectedHit = RaycastBruteForce(Vertices, Indices, Start, End, ExpectedDistance);
+
+            FSimpleMeshBVHHit Hit;
+            const bool bHit = BVH.Raycast(Vertices, Indices, FVector3f(Start), FVector3f((End - Start) / Length), (float)Length, Hit);
+
+            // Rays grazing an edge may go either way
+            if (bHit != bExpectedHit || (bHit && !FMath::IsNearlyEqual((double)Hit.Distance, ExpectedDistance, 0.01 + ExpectedDistance * 1e-4)))
+            {
+                NumMismatches++;
+            }
+        }
+
+        for (int32 QueryIdx = 0; QueryIdx < NumQueries / 10; QueryIdx++)
+        {
+            const FVector3f Center = FVector3f(Random.RandPointInBox(FBox(Bounds)));
+            const FBox3f Box = FBox3f::BuildAABB(Center, FVector3f(Random.FRandRange(1.f, 200.f)));
+
+            TArray<int32> Overlapping;
+            BVH.OverlapBox(Vertices, Indices, Box, Overlapping);
+            TSet<int32> OverlappingSet(Overlapping);
+
+            // Exact overlap is in between: triangles with a corner inside, and triangles whose box touches
+            for (int32 TriIdx = 0; TriIdx < Indices.Num() / 3; TriIdx++)
+            {
+                const FVector3f& P0 = Vertices[Indices[TriIdx * 3 + 0]].Position;
+                const FVector3f& P1 = Vertices[Indices[TriIdx * 3 + 1]].Position;
+                const FVector3f& P2 = Vertices[Indices[TriIdx * 3 + 2]].Position;
+                const bool bCornerInside = Box.IsInsideOrOn(P0) || Box.IsInsideOrOn(P1) || Box.IsInsideOrOn(P2);
+                FBox3f TriangleBox(ForceInit);
+                TriangleBox += P0;
+                TriangleBox += P1;
+                TriangleBox += P2;
+                const bool bFound = OverlappingSet.Contains(TriIdx);
+                if ((bCornerInside && !bFound) || (bFound && !TriangleBox.Intersect(Box)))
+                {
+                    NumMismatches++;
+                }
+            }
+        }
+
+        return NumMismatches;
+    }
+}
+
+/** BVH queries must return what testing every triangle returns, after a build and after a refit */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSimpleMeshBVHCorrectnessTest, "SimpleMesh.BVH.Correctness",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSimpleMeshBVHCorrectnessTest::RunTest(const FString& Parameters)
+{
+    using namespace SimpleMeshBVHTest;
+
+    const int32 NumQueries = 2000;
+
+    // Large enough for the parallel build
+    TArray<FVector> GridVertices;
+    TArray<int32> GridTriangles;
+    FSimpleMeshTestWorld::MakeGrid(96, 20.f, [](float X, float Y) { return 150.f * FMath::Sin(X / 300.f) * FMath::Cos(Y / 200.f); }, GridVertices, GridTriangles);
+
+    TArray<FDynamicMeshVertex> Vertices;
+    for (const FVector& Position : GridVertices)
+    {
+        Vertices.Emplace(FVector3f(Position));
+    }
+    TArray<uint32> Indices;
+    for (const int32 Index : GridTriangles)
+    {
+        Indices.Add((uint32)Index);
+    }
+
+    FSimpleMeshBVH BVH;
+    BVH.Build(Vertices, Indices);
+    TestEqual(TEXT("Every triangle is in the BVH"), BVH.GetNumTriangles(), Indices.Num() / 3);
+
+    const int32 BuildMismatches = CompareWithBruteForce(BVH, Vertices, Indices, BVH.GetBounds(), NumQueries);
+    TestTrue(FString::Printf(TEXT("Built BVH matches brute force (%d mismatches)"), BuildMismatches), BuildMismatches <= NumQueries / 1000);
+
+    // Moving the vertices only needs a refit
+    for (FDynamicMeshVertex& Vertex : Vertices)
+    {
+        Vertex.Position.Z = 300.f * FMath::Cos(Vertex.Position.X / 150.f) + Vertex.Position.Y * 0.1f;
+    }
+    BVH.Refit(Vertices, Indices);
+
+    const int32 RefitMismatches = CompareWithBruteForce(BVH, Vertices, Indices, BVH.GetBounds(), NumQueries);
+    TestTrue(FString::Printf(TEXT("Refitted BVH matches brute force (%d mismatches)"), RefitMismatches), RefitMismatches <= NumQueries / 1000);
+
+    return !HasAnyErrors();
+}
+
+#endif
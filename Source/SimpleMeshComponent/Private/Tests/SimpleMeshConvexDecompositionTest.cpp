@@ -0,0 +1,78 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHCONVEXDECOMPOSITIONTEST---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHCONVEXDECOMPOSITIONTEST---------//
+
+#include "SimpleMeshConvexDecomposition.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+namespace SimpleMeshConvexDecompositionTest
+{
+    /** Closed box, appended to a triangle soup */
+    static void AddBox(const FBox3f& Box, TArray<FVector3f>& Positions, TArray<uint32>& Indices)
+    {
+        const uint32 Base = Positions.Num();
+        for (int32 Corner = 0; Corner < 8; Corner++)
+        {
+            Positions.Emplace(
+                (Corner & 1) ? Box.Max.X : Box.Min.X,
+                (Corner & 2) ? Box.Max.Y : Box.Min.Y,
+                (Corner & 4) ? Box.Max.Z : Box.Min.Z);
+        }
+
+        static const uint32 Faces[6][4] = { { 0, 2, 3, 1 }, { 4, 5, 7, 6 }, { 0, 1, 5, 4 }, { 2, 6, 7, 3 }, { 0, 4, 6, 2 }, { 1, 3, 7, 5 } };
+        for (const uint32* Face : Faces)
+        {
+            Indices.Append({ Base + Face[0], Base + Face[1], Base + Face[2], Base + Face[0], Base + Face[2], Base + Face[3] });
+        }
+    }
+}
+
+/** An L shape cannot be one hull: it must be split, and the hulls must cover the L without filling its notch */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSimpleMeshConvexDecompositionTest, "SimpleMesh.Collision.ConvexDecomposition",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSimpleMeshConvexDecompositionTest::RunTest(const FString& Parameters)
+{
+    using namespace SimpleMeshConvexDecompositionTest;
+
+    // Two arms of 300 x 100, the notch is the 200 x 200 square they leave empty, less the thickness flat hulls may get
+    TArray<FVector3f> Positions;
+    TArray<uint32> Indices;
+    AddBox(FBox3f(FVector3f(0.f, 0.f, 0.f), FVector3f(300.f, 100.f, 100.f)), Positions, Indices);
+    AddBox(FBox3f(FVector3f(0.f, 100.f, 0.f), FVector3f(100.f, 300.f, 100.f)), Positions, Indices);
+    const FBox3f Notch(FVector3f(120.f, 120.f, 20.f), FVector3f(280.f, 280.f, 80.f));
+
+    FSimpleMeshConvexDecompositionSettings Settings;
+    TArray<TArray<FVector>> Hulls;
+    SimpleMeshConvexDecomposition::Decompose(Positions, Indices, Settings, Hulls);
+
+    TestTrue(FString::Printf(TEXT("The L is split into 2 to %d hulls (%d)"), Settings.MaxHullCount, Hulls.Num()), Hulls.Num() >= 2 && Hulls.Num() <= Settings.MaxHullCount);
+
+    // Pieces of an L cut along axis planes are boxes, their bounds are the hulls
+    TArray<FBox> HullBoxes;
+    for (int32 HullIdx = 0; HullIdx < Hulls.Num(); HullIdx++)
+    {
+        const TArray<FVector>& Hull = Hulls[HullIdx];
+        TestTrue(FString::Printf(TEXT("Hull %d has 4 to %d points (%d)"), HullIdx, Settings.MaxHullVertices, Hull.Num()), Hull.Num() >= 4 && Hull.Num() <= Settings.MaxHullVertices);
+
+        const FBox HullBox(Hull);
+        HullBoxes.Add(HullBox);
+        TestFalse(FString::Printf(TEXT("Hull %d stays out of the notch"), HullIdx), HullBox.Intersect(FBox(Notch)));
+    }
+
+    int32 NumUncovered = 0;
+    for (const FVector3f& Position : Positions)
+    {
+        NumUncovered += HullBoxes.ContainsByPredicate([&Position](const FBox& HullBox) { return HullBox.ExpandBy(1.0).IsInsideOrOn(FVector(Position)); }) ? 0 : 1;
+    }
+    TestEqual(TEXT("Every corner of the L is inside a hull"), NumUncovered, 0);
+
+    return !HasAnyErrors();
+}
+
+#endif
@@ -0,0 +1,77 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHPROXYTEST---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHPROXYTEST---------//
+
+#include "SimpleMeshTestWorld.h"
+#include "HAL/IConsoleManager.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Preparing the sections of a proxy in parallel must give the same render sections as preparing them one after the other */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSimpleMeshProxyParallelTest, "SimpleMesh.Proxy.ParallelSections",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSimpleMeshProxyParallelTest::RunTest(const FString& Parameters)
+{
+    IConsoleVariable* ThresholdCVar = IConsoleManager::Get().FindConsoleVariable(TEXT("SimpleMesh.Proxy.ParallelSectionThreshold"));
+    if (!TestNotNull(TEXT("SimpleMesh.Proxy.ParallelSectionThreshold exists"), ThresholdCVar))
+    {
+        return false;
+    }
+
+    FSimpleMeshTestWorld TestWorld;
+    USimpleMeshComponent* Component = TestWorld.CreateComponent();
+    Component->SetVisibility(false);
+
+    // Neighbouring sections differ in size so a section in the wrong slot shows, free slots in between
+    const int32 NumSections = 64;
+    TArray<FVector> Vertices;
+    TArray<int32> Triangles;
+    for (int32 SectionIdx = 0; SectionIdx < NumSections; SectionIdx++)
+    {
+        FSimpleMeshTestWorld::MakeGrid(2 + SectionIdx % 13, 10.f, [SectionIdx](float X, float Y) { return (float)SectionIdx; }, Vertices, Triangles);
+        Component->CreateMeshSection(SectionIdx * 2, Vertices, Triangles, nullptr);
+    }
+
+    const int32 SavedThreshold = ThresholdCVar->GetInt();
+    FSimpleSceneProxy* Proxies[2];
+    for (int32 Mode = 0; Mode < 2; Mode++)
+    {
+        ThresholdCVar->Set(Mode == 0 ? 0 : 1, ECVF_SetByCode);
+        Proxies[Mode] = new FSimpleSceneProxy(Component);
+    }
+    ThresholdCVar->Set(SavedThreshold, ECVF_SetByCode);
+
+    for (int32 SectionIndex = 0; SectionIndex < Component->MeshSections.GetMaxIndex(); SectionIndex++)
+    {
+        const FSimpleMeshSceneSection* Serial = Proxies[0]->GetSceneSection(SectionIndex);
+        const FSimpleMeshSceneSection* Parallel = Proxies[1]->GetSceneSection(SectionIndex);
+        if (!TestEqual(FString::Printf(TEXT("Section %d exists in both proxies"), SectionIndex), Serial != nullptr, Parallel != nullptr) || Serial == nullptr)
+        {
+            continue;
+        }
+
+        TestEqual(FString::Printf(TEXT("Section %d triangles"), SectionIndex), Serial->NumPrimitives, Parallel->NumPrimitives);
+        TestEqual(FString::Printf(TEXT("Section %d vertices"), SectionIndex), Serial->PositionBuffer.GetNumVertices(), Parallel->PositionBuffer.GetNumVertices());
+        TestEqual(FString::Printf(TEXT("Section %d triangles match the component"), SectionIndex), Serial->NumPrimitives, Component->MeshSections[SectionIndex].IndexBuffer.Num() / 3);
+        TestEqual(FString::Printf(TEXT("Section %d material"), SectionIndex), Serial->Material, Parallel->Material);
+        TestEqual(FString::Printf(TEXT("Section %d validity"), SectionIndex), Serial->CanRender(), Parallel->CanRender());
+        TestEqual(FString::Printf(TEXT("Section %d shadow section"), SectionIndex), Serial->ShadowSection != nullptr, Parallel->ShadowSection != nullptr);
+    }
+
+    ENQUEUE_RENDER_COMMAND(DeleteSimpleMeshTestProxies)([Serial = Proxies[0], Parallel = Proxies[1]](FRHICommandListImmediate&)
+    {
+        delete Serial;
+        delete Parallel;
+    });
+    FlushRenderingCommands();
+
+    Component->DestroyComponent();
+    return !HasAnyErrors();
+}
+
+#endif
@@ -0,0 +1,74 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHSIMPLIFYTEST---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHSIMPLIFYTEST---------//
+
+#include "SimpleMeshSimplify.h"
+#include "Misc/AutomationTest.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Simplify a synthetic terrain the way collision meshes are, and check the result stays within the tolerance of the original */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSimpleMeshCollisionErrorTest, "SimpleMesh.Collision.ErrorTest",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSimpleMeshCollisionErrorTest::RunTest(const FString& Parameters)
+{
+    const int32 Resolution = 256;
+    const float Spacing = 50.f;
+
+    // Flat on one half, rolling hills on the other, with a sharp ridge through the middle
+    TArray<FVector3f> Positions;
+    Positions.Reserve(FMath::Square(Resolution + 1));
+    for (int32 Y = 0; Y <= Resolution; Y++)
+    {
+        for (int32 X = 0; X <= Resolution; X++)
+        {
+            const float PosX = X * Spacing;
+            const float PosY = Y * Spacing;
+            float Height = 0.f;
+            if (X > Resolution / 2)
+            {
+                Height = 300.f * FMath::Sin(PosX / 1500.f) * FMath::Cos(PosY / 1100.f);
+            }
+            Height += FMath::Max(0.f, 200.f - FMath::Abs(PosY - Resolution * Spacing * 0.5f) * 2.f);
+            Positions.Add(FVector3f(PosX, PosY, Height));
+        }
+    }
+
+    TArray<uint32> Indices;
+    Indices.Reserve(Resolution * Resolution * 6);
+    const int32 RowSize = Resolution + 1;
+    for (int32 Y = 0; Y < Resolution; Y++)
+    {
+        for (int32 X = 0; X < Resolution; X++)
+        {
+            const uint32 A = Y * RowSize + X;
+            const uint32 B = A + 1;
+            const uint32 C = A + RowSize + 1;
+            const uint32 D = A + RowSize;
+            Indices.Append({ A, C, B, A, D, C });
+        }
+    }
+
+    for (const float MaxError : { 0.5f, 2.f, 10.f })
+    {
+        TArray<FVector3f> CollisionPositions;
+        TArray<uint32> CollisionIndices;
+        const int32 NumCollisionTriangles = SimpleMeshSimplify::SimplifyMesh(Positions, Indices, MaxError, CollisionPositions, CollisionIndices);
+        const float Deviation = SimpleMeshSimplify::ComputeMaxDeviation(Positions, Indices, CollisionPositions, CollisionIndices, MaxError * 4.f);
+
+        TestTrue(FString::Printf(TEXT("Tolerance %.1f simplifies the flat half"), MaxError), NumCollisionTriangles > 0 && NumCollisionTriangles < Indices.Num() / 3);
+        if (Deviation > MaxError)
+        {
+            AddError(FString::Printf(TEXT("Collision error test FAILED: %d -> %d triangles, max deviation %.3f (tolerance %.3f)"),
+                Indices.Num() / 3, NumCollisionTriangles, Deviation, MaxError));
+        }
+    }
+
+    return !HasAnyErrors();
+}
+
+#endif
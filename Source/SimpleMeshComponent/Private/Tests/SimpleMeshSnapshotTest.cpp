@@ -0,0 +1,124 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHSNAPSHOTTEST---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHSNAPSHOTTEST---------//
+
+#include "SimpleMeshTestWorld.h"
+#include "SimpleMeshSnapshot.h"
+#include "Async/Async.h"
+#include "Misc/AutomationTest.h"
+#include <atomic>
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Readers on worker threads check every snapshot they get while the game thread rewrites the sections as fast as it can */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSimpleMeshSnapshotStressTest, "SimpleMesh.Snapshot.StressTest",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::EngineFilter)
+
+bool FSimpleMeshSnapshotStressTest::RunTest(const FString& Parameters)
+{
+    const int32 NumUpdates = 2000;
+    const int32 NumReaders = 4;
+
+    FSimpleMeshTestWorld TestWorld;
+    USimpleMeshComponent* Component = TestWorld.CreateComponent();
+    Component->bPublishSectionSnapshots = true;
+
+    std::atomic<bool> bStop{ false };
+    std::atomic<int64> NumReads{ 0 };
+    std::atomic<int32> NumErrors{ 0 };
+
+    TArray<TFuture<void>> Readers;
+    for (int32 ReaderIdx = 0; ReaderIdx < NumReaders; ReaderIdx++)
+    {
+        Readers.Add(Async(EAsyncExecution::Thread, [Component, &bStop, &NumReads, &NumErrors]()
+        {
+            uint32 LastVersion = 0;
+            while (!bStop.load())
+            {
+                const FSimpleMeshSnapshotPtr Snapshot = Component->GetSnapshot();
+                if (!Snapshot.IsValid())
+                {
+                    continue;
+                }
+
+                bool bValid = Snapshot->Version >= LastVersion;
+                LastVersion = Snapshot->Version;
+                for (const FSimpleMeshSectionSnapshotPtr& Section : Snapshot->Sections)
+                {
+                    if (!Section.IsValid())
+                    {
+                        continue;
+                    }
+
+                    // Each update writes one value in every X, a torn copy would mix two updates
+                    bValid &= Section->Version <= Snapshot->Version && Section->Indices.Num() == Section->Positions.Num();
+                    for (int32 Idx = 0; Idx < Section->Indices.Num() && bValid; Idx++)
+                    {
+                        bValid &= Section->Indices[Idx] < (uint32)Section->Positions.Num() && Section->Positions[Idx].X == Section->Positions[0].X;
+                    }
+                }
+
+                NumErrors += bValid ? 0 : 1;
+                NumReads++;
+            }
+        }));
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    TArray<FVector> Vertices;
+    TArray<int32> Triangles;
+    for (int32 Update = 0; Update < NumUpdates; Update++)
+    {
+        // The size changes every update so the buffers get reallocated under the readers
+        const int32 NumVertices = 3 * (1 + Update % 64);
+        Vertices.Reset();
+        Triangles.Reset();
+        for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+        {
+            Vertices.Emplace((double)Update, (double)VertIdx, (double)(VertIdx % 3));
+            Triangles.Add(VertIdx);
+        }
+
+        if (Update == 0)
+        {
+            Component->CreateMeshSection(0, Vertices, Triangles, nullptr);
+        }
+        else
+        {
+            Component->UpdateMeshSection(0, Vertices, Triangles, false);
+        }
+
+        // A second slot comes and goes
+        if (Update % 2 == 0)
+        {
+            Component->CreateMeshSection(1, Vertices, Triangles, nullptr);
+        }
+        else
+        {
+            Component->RemoveMeshSection(1);
+        }
+
+        Component->PublishSectionSnapshots();
+    }
+    const double UpdateTime = FPlatformTime::Seconds() - StartTime;
+
+    bStop = true;
+    for (TFuture<void>& Reader : Readers)
+    {
+        Reader.Wait();
+    }
+
+    if (NumErrors.load() > 0)
+    {
+        AddError(FString::Printf(TEXT("Snapshot stress test FAILED: %d of %lld reads were inconsistent"), NumErrors.load(), NumReads.load()));
+    }
+    AddInfo(FString::Printf(TEXT("%d updates in %.2f ms, %d readers made %lld reads"), NumUpdates, UpdateTime * 1000.0, NumReaders, NumReads.load()));
+
+    Component->DestroyComponent();
+    return NumErrors.load() == 0;
+}
+
+#endif
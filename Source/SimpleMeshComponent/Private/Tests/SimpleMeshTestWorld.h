@@ -0,0 +1,66 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHTESTWORLD---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHTESTWORLD---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/Engine.h"
+#include "Engine/World.h"
+#include "RenderingThread.h"
+#include "SimpleMeshComponent.h"
+
+#if WITH_DEV_AUTOMATION_TESTS
+
+/** Game world with a scene for the duration of a test, components made with it are registered like in a level */
+class FSimpleMeshTestWorld
+{
+public:
+    FSimpleMeshTestWorld()
+    {
+        World = UWorld::CreateWorld(EWorldType::Game, false);
+        FWorldContext& WorldContext = GEngine->CreateNewWorldContext(EWorldType::Game);
+        WorldContext.SetCurrentWorld(World);
+    }
+
+    ~FSimpleMeshTestWorld()
+    {
+        FlushRenderingCommands();
+        GEngine->DestroyWorldContext(World);
+        World->DestroyWorld(false);
+    }
+
+    USimpleMeshComponent* CreateComponent() const
+    {
+        USimpleMeshComponent* Component = NewObject<USimpleMeshComponent>(World, NAME_None, RF_Transient);
+        Component->RegisterComponentWithWorld(World);
+        return Component;
+    }
+
+    /** Grid of Size x Size quads, Z from HeightFunc */
+    static void MakeGrid(int32 Size, float Spacing, TFunctionRef<float(float X, float Y)> HeightFunc, TArray<FVector>& OutVertices, TArray<int32>& OutTriangles)
+    {
+        OutVertices.Reset();
+        OutTriangles.Reset();
+        const int32 RowSize = Size + 1;
+        for (int32 Y = 0; Y <= Size; Y++)
+        {
+            for (int32 X = 0; X <= Size; X++)
+            {
+                OutVertices.Emplace(X * Spacing, Y * Spacing, HeightFunc(X * Spacing, Y * Spacing));
+                if (X < Size && Y < Size)
+                {
+                    const int32 Index = Y * RowSize + X;
+                    OutTriangles.Append({ Index, Index + RowSize + 1, Index + 1, Index, Index + RowSize, Index + RowSize + 1 });
+                }
+            }
+        }
+    }
+
+    UWorld* World = nullptr;
+};
+
+#endif
@@ -0,0 +1,89 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHBVH---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHBVH---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FDynamicMeshVertex;
+
+/** Closest triangle hit by a ray, in the space of the section */
+struct FSimpleMeshBVHHit
+{
+    /** Distance along the normalized ray direction */
+    float Distance = 0.f;
+
+    /** Triangle index in the section (first index at TriangleIndex * 3) */
+    int32 TriangleIndex = INDEX_NONE;
+
+    /** Barycentric coordinates of the hit relative to the second and third corner */
+    float U = 0.f;
+    float V = 0.f;
+
+    /** Unit face normal, same winding as the generated normals */
+    FVector3f Normal = FVector3f::ZeroVector;
+};
+
+/**
+ *	Bounding volume hierarchy over the triangles of one section, for raycasts and overlaps without going through physics.
+ *	Built top down with a binned SAH, subtrees are built in parallel. Moving vertices only needs a Refit.
+ *	The BVH does not keep a copy of the geometry: every call takes the vertices and indices it was built from.
+ */
+class SIMPLEMESHCOMPONENT_API FSimpleMeshBVH
+{
+public:
+
+    /** Triangles per leaf below which a node is never split */
+    static constexpr int32 MaxLeafTriangles = 4;
+
+    /** Triangle count above which both children of a node are built in parallel */
+    static constexpr int32 ParallelBuildThreshold = 8192;
+
+    /** Build from scratch, triangles pointing outside Vertices are left out */
+    void Build(TConstArrayView<FDynamicMeshVertex> Vertices, TConstArrayView<uint32> Indices);
+
+    /** Update the node boxes after vertices moved, the topology must be the one the BVH was built from */
+    void Refit(TConstArrayView<FDynamicMeshVertex> Vertices, TConstArrayView<uint32> Indices);
+
+    /**
+     *	Closest hit along a ray, both faces of triangles are hit.
+     *	@param	Direction		Normalized direction.
+     */
+    bool Raycast(TConstArrayView<FDynamicMeshVertex> Vertices, TConstArrayView<uint32> Indices, const FVector3f& Origin, const FVector3f& Direction, float MaxDistance, FSimpleMeshBVHHit& OutHit) const;
+
+    /** Append every triangle that intersects a box */
+    void OverlapBox(TConstArrayView<FDynamicMeshVertex> Vertices, TConstArrayView<uint32> Indices, const FBox3f& Box, TArray<int32>& OutTriangles) const;
+
+    bool IsEmpty() const { return Nodes.Num() == 0; }
+
+    int32 GetNumTriangles() const { return Triangles.Num(); }
+
+    /** Box of every triangle */
+    FBox3f GetBounds() const;
+
+    SIZE_T GetAllocatedSize() const { return Nodes.GetAllocatedSize() + Triangles.GetAllocatedSize(); }
+
+private:
+
+    /** Leaf if Count > 0: Triangles[Index, Index + Count). Otherwise children are Index and Index + 1. */
+    struct FNode
+    {
+        FVector3f Min;
+        int32 Index;
+        FVector3f Max;
+        int32 Count;
+    };
+
+    struct FBuildContext;
+
+    void BuildNode(FBuildContext& Context, int32 NodeIndex, int32 First, int32 Count, int32 Depth);
+
+    TArray<FNode> Nodes;
+
+    /** Triangle indices, ordered so each leaf owns a contiguous run */
+    TArray<int32> Triangles;
+};
@@ -0,0 +1,133 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHBUFFERPOOL---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHBUFFERPOOL---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "RenderResource.h"
+#include "RHI.h"
+#include "LocalVertexFactory.h"
+
+struct FDynamicMeshVertex;
+
+/** Counters of the buffer pool since startup */
+struct FSimpleMeshBufferPoolStats
+{
+    /** Buffers handed out from the pool */
+    int32 Hits = 0;
+
+    /** Buffers that had to be created */
+    int32 Misses = 0;
+
+    /** Released buffers dropped because the pool was full */
+    int32 Discards = 0;
+
+    /** Buffers currently waiting in the pool */
+    int32 NumPooled = 0;
+
+    /** Size of the buffers waiting in the pool */
+    uint64 PooledBytes = 0;
+
+    /** Largest PooledBytes reached */
+    uint64 PeakPooledBytes = 0;
+};
+
+/**
+ *	Render thread pool of static vertex/index RHI buffers, shared by every section of every component.
+ *	Sizes are rounded up to buckets (four per power of two) so a released buffer fits the next section of about the same size.
+ *	The pool never holds more than SimpleMesh.BufferPool.MaxPooledMB, extra buffers are freed on release.
+ *	It is a global render resource: the pooled buffers are freed in ReleaseRHI, before the RHI shuts down.
+ */
+class SIMPLEMESHCOMPONENT_API FSimpleMeshBufferPool : public FRenderResource
+{
+public:
+
+    static FSimpleMeshBufferPool& Get();
+
+    /** Render thread. A buffer of at least Size bytes, its real size is the bucket size */
+    FBufferRHIRef Acquire(FRHICommandListBase& RHICmdList, EBufferUsageFlags Usage, uint32 Stride, uint32 Size, const TCHAR* DebugName);
+
+    /** Render thread. Give a buffer back, the reference is cleared */
+    void Release(FBufferRHIRef& Buffer);
+
+    /** Render thread. Free every pooled buffer */
+    void Trim();
+
+    /** Render thread */
+    FSimpleMeshBufferPoolStats GetStats() const { return Stats; }
+
+    /** Size a request of Size bytes is rounded up to */
+    static uint32 GetBucketSize(uint32 Size);
+
+    //~ Begin FRenderResource Interface.
+    virtual void ReleaseRHI() override;
+    virtual FString GetFriendlyName() const override { return TEXT("FSimpleMeshBufferPool"); }
+    //~ End FRenderResource Interface.
+
+private:
+
+    struct FBucketKey
+    {
+        EBufferUsageFlags Usage;
+        uint32 Stride;
+        uint32 Size;
+
+        bool operator==(const FBucketKey& Other) const
+        {
+            return Usage == Other.Usage && Stride == Other.Stride && Size == Other.Size;
+        }
+
+        friend uint32 GetTypeHash(const FBucketKey& Key)
+        {
+            return HashCombine(HashCombine(::GetTypeHash((uint32)Key.Usage), ::GetTypeHash(Key.Stride)), ::GetTypeHash(Key.Size));
+        }
+    };
+
+    TMap<FBucketKey, TArray<FBufferRHIRef>> FreeBuffers;
+    FSimpleMeshBufferPoolStats Stats;
+};
+
+/** Position stream of a section, its RHI buffer comes from FSimpleMeshBufferPool */
+class SIMPLEMESHCOMPONENT_API FSimpleMeshPooledPositionBuffer : public FVertexBuffer
+{
+public:
+
+    /** Copy the positions to upload, they are freed once on the GPU */
+    void Init(const TArray<FDynamicMeshVertex>& Vertices);
+
+    uint32 GetNumVertices() const { return NumVertices; }
+
+    /** Fill the position stream of a local vertex factory */
+    void Bind(FLocalVertexFactory::FDataType& Data) const;
+
+    //~ Begin FRenderResource Interface.
+    virtual void InitRHI(FRHICommandListBase& RHICmdList) override;
+    virtual void ReleaseRHI() override;
+    virtual FString GetFriendlyName() const override { return TEXT("FSimpleMeshPooledPositionBuffer"); }
+    //~ End FRenderResource Interface.
+
+private:
+
+    TArray<FVector3f> Positions;
+    uint32 NumVertices = 0;
+    FShaderResourceViewRHIRef PositionSRV;
+};
+
+/** 32 bit index buffer of a section, its RHI buffer comes from FSimpleMeshBufferPool */
+class SIMPLEMESHCOMPONENT_API FSimpleMeshPooledIndexBuffer : public FIndexBuffer
+{
+public:
+
+    /** Indices to upload, freed once on the GPU */
+    TArray<uint32> Indices;
+
+    //~ Begin FRenderResource Interface.
+    virtual void InitRHI(FRHICommandListBase& RHICmdList) override;
+    virtual void ReleaseRHI() override;
+    virtual FString GetFriendlyName() const override { return TEXT("FSimpleMeshPooledIndexBuffer"); }
+    //~ End FRenderResource Interface.
+};
@@ -0,0 +1,92 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHBUILDER---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHBUILDER---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "UObject/Object.h"
+#include "SimpleMeshComponent.h"
+
+#include "SimpleMeshBuilder.generated.h"
+
+/**
+ *	Accumulates geometry natively, in the vertex/index format of the sections, for Blueprint tools:
+ *	shapes are appended without growing Blueprint arrays, and the result is moved into a section on commit.
+ *	Quads go counter clockwise around their front face, shapes come with hard normals and 0..1 UVs.
+ */
+
+UCLASS(BlueprintType)
+class SIMPLEMESHCOMPONENT_API USimpleMeshBuilder : public UObject
+{
+    GENERATED_BODY()
+
+public:
+
+    /** Forget the accumulated geometry, the memory is kept for the next shapes */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void Reset();
+
+    /** Reserve room for what is about to be appended */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void Reserve(int32 NumVertices, int32 NumTriangles);
+
+    /** @return	Index of the new vertex, for AddTriangle */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    int32 AddVertex(FVector Position, FVector Normal = FVector::UpVector, FVector2D UV = FVector2D::ZeroVector, FLinearColor Color = FLinearColor::White);
+
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void AddTriangle(int32 A, int32 B, int32 C);
+
+    /** Flat quad with its own 4 vertices. @return Index of the vertex of A. */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    int32 AddQuad(FVector A, FVector B, FVector C, FVector D);
+
+    /** Grid of NumX * NumY quads sharing their vertices, spanning AxisX and AxisY from Origin. The front face is AxisX ^ AxisY. */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void AddGrid(FVector Origin, FVector AxisX, FVector AxisY, int32 NumX = 1, int32 NumY = 1);
+
+    /** Axis aligned box, faces outward */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void AddBox(FVector Center, FVector Extent);
+
+    /**
+     *	Walls of a polygon extruded along Z.
+     *	@param	Profile		Polygon in the XY plane, counter clockwise seen from +Z. Closed: the last point connects to the first.
+     *	@param	bCapEnds	Close the bottom and top with a fan, for convex profiles.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void AddExtrusion(const TArray<FVector2D>& Profile, FVector Base, float Height, bool bCapEnds = true);
+
+    /** Append positions and triangles in the CreateMeshSection layout. They have no normals, so the committed section generates its normals. */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void AppendMesh(const TArray<FVector>& Vertices, const TArray<int32>& Triangles);
+
+    UFUNCTION(BlueprintPure, Category = "Components|SimpleMesh")
+    int32 GetNumVertices() const { return Section.VertexBuffer.Num(); }
+
+    UFUNCTION(BlueprintPure, Category = "Components|SimpleMesh")
+    int32 GetNumTriangles() const { return Section.IndexBuffer.Num() / 3; }
+
+    /**
+     *	Move the geometry into a section of Component, creating or replacing it. The builder is empty afterwards.
+     *	Same parameters as CreateMeshSection.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void CommitToSection(USimpleMeshComponent* Component, int32 SectionIndex, UMaterialInterface* Material, bool bSectionVisible = true, bool bCreateCollision = false);
+
+    /** Accumulated section, for native code appending its own vertices */
+    FSimpleMeshSection& GetSection() { return Section; }
+
+private:
+
+    int32 AddVertexInternal(const FVector3f& Position, const FVector3f& Normal, const FVector2f& UV, const FColor& Color);
+
+    /** A, B, C, D go counter clockwise around the front face */
+    void AddQuadIndices(int32 A, int32 B, int32 C, int32 D);
+
+    FSimpleMeshSection Section;
+};
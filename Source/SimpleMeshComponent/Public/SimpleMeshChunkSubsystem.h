@@ -0,0 +1,145 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHCHUNKSUBSYSTEM---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHCHUNKSUBSYSTEM---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "SimpleMeshChunkSubsystem.generated.h"
+
+class USimpleMeshComponent;
+
+/**
+ *	Fills the component of a chunk. The component is placed at the chunk origin, geometry is relative to it.
+ *	Sections left from the previous chunk are kept so their memory is reused: overwrite them with CreateMeshSection
+ *	and remove the extra ones.
+ */
+DECLARE_DYNAMIC_DELEGATE_TwoParams(FSimpleMeshChunkGenerator, FIntVector, ChunkCoord, USimpleMeshComponent*, Component);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnSimpleMeshChunkReleased, FIntVector, ChunkCoord, USimpleMeshComponent*, Component);
+
+/**
+ *	Streams a grid of chunks around the viewers, one USimpleMeshComponent per chunk.
+ *	Components leaving the streaming radius go back to a pool and are handed to the next chunks,
+ *	chunks are generated nearest first within a per frame time budget.
+ */
+
+UCLASS()
+class SIMPLEMESHCOMPONENT_API USimpleMeshChunkSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+
+    //~ Begin UTickableWorldSubsystem Interface.
+    virtual void Deinitialize() override;
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+    //~ End UTickableWorldSubsystem Interface.
+
+    /** Start streaming, chunks are generated by Generator. Unbinding it stops streaming and releases every chunk */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void SetChunkGenerator(const FSimpleMeshChunkGenerator& Generator);
+
+    /** Stream around this actor in addition to the local players */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void AddViewer(AActor* Viewer);
+
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void RemoveViewer(AActor* Viewer);
+
+    /** Queue a loaded chunk to be generated again, e.g. after its source data changed. Shares the priority and the budget of the streaming. */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void RequestChunkRebuild(FIntVector ChunkCoord);
+
+    /** Release every chunk to the pool */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void ReleaseAllChunks();
+
+    /** Component of a loaded chunk, null if the chunk is not loaded */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    USimpleMeshComponent* GetChunkComponent(FIntVector ChunkCoord) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    FIntVector WorldToChunk(const FVector& WorldLocation) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    FVector ChunkToWorld(FIntVector ChunkCoord) const;
+
+    /** Called when a chunk leaves the streaming radius, just before its component goes back to the pool */
+    UPROPERTY(BlueprintAssignable, Category = "Components|SimpleMesh")
+        FOnSimpleMeshChunkReleased OnChunkReleased;
+
+    /** World size of a chunk */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|SimpleMesh", meta = (ClampMin = "1"))
+        float ChunkSize = 3200.f;
+
+    /** Chunks closer than this many chunks to a viewer are loaded */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|SimpleMesh", meta = (ClampMin = "0"))
+        int32 LoadRadius = 4;
+
+    /** Chunks further than this many chunks from every viewer are released, keep it above LoadRadius to avoid churn */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|SimpleMesh", meta = (ClampMin = "0"))
+        int32 UnloadRadius = 6;
+
+    /** Stream in 3D, otherwise chunks are columns and ChunkCoord.Z is always 0 */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|SimpleMesh")
+        bool bVerticalChunks = false;
+
+    /** Time spent generating chunks each frame, at least one chunk is generated per frame */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|SimpleMesh", meta = (ClampMin = "0"))
+        float FrameBudgetMs = 2.f;
+
+    /** Released components kept for reuse, the extra ones are destroyed */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Streaming|SimpleMesh", meta = (ClampMin = "0"))
+        int32 MaxPooledComponents = 64;
+
+private:
+
+    /** Viewer locations, local players and registered viewers */
+    void GatherViewerLocations(TArray<FVector>& OutLocations) const;
+
+    /** Distance in chunks from a chunk to the nearest viewer chunk */
+    int32 GetChunkDistance(const FIntVector& ChunkCoord, TConstArrayView<FIntVector> ViewerChunks) const;
+
+    /** Queue the chunks around the viewers that are not loaded yet */
+    void QueueMissingChunks(TConstArrayView<FIntVector> ViewerChunks);
+
+    /** Component from the pool, or a new one */
+    USimpleMeshComponent* AcquireComponent(const FIntVector& ChunkCoord);
+
+    void ReleaseChunk(const FIntVector& ChunkCoord);
+
+    /** Actor that owns every chunk component */
+    AActor* GetOrCreateHostActor();
+
+    UPROPERTY()
+        FSimpleMeshChunkGenerator ChunkGenerator;
+
+    UPROPERTY(Transient)
+        TObjectPtr<AActor> HostActor;
+
+    UPROPERTY(Transient)
+        TMap<FIntVector, TObjectPtr<USimpleMeshComponent>> LoadedChunks;
+
+    UPROPERTY(Transient)
+        TArray<TObjectPtr<USimpleMeshComponent>> ComponentPool;
+
+    TArray<TWeakObjectPtr<AActor>> Viewers;
+
+    /** Chunks waiting to be generated or regenerated */
+    TArray<FIntVector> PendingChunks;
+    TSet<FIntVector> PendingChunkSet;
+
+    /** Chunks were queued since PendingChunks was last sorted */
+    bool bSortPendingChunks = false;
+
+    /** Viewer chunks the missing chunks were last queued for */
+    TArray<FIntVector> LastViewerChunks;
+};
@@ -0,0 +1,89 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHCOLLISIONCACHE---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHCOLLISIONCACHE---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Chaos/TriangleMeshImplicitObject.h"
+
+class UBodySetup;
+struct FTriMeshCollisionData;
+
+#if UE_VERSION_OLDER_THAN(5, 4, 0)
+using FSimpleMeshTriMeshPtr = TSharedPtr<Chaos::FTriangleMeshImplicitObject, ESPMode::ThreadSafe>;
+#else
+using FSimpleMeshTriMeshPtr = Chaos::FTriangleMeshImplicitObjectPtr;
+#endif
+
+/** Counters of the collision cache since startup */
+struct FSimpleMeshCollisionCacheStats
+{
+    /** Lookups served from memory */
+    int32 MemoryHits = 0;
+
+    /** Lookups served from the local disk cache */
+    int32 DiskHits = 0;
+
+    /** Lookups that had to cook */
+    int32 Misses = 0;
+
+    /** Cooked results added to the cache */
+    int32 Stores = 0;
+};
+
+/**
+ *	Cooked complex collision shared between components and sessions, keyed by a hash of exactly what gets cooked
+ *	(trimesh positions, indices and cook flags). Results live in memory and in Saved/SimpleMeshCollisionCache.
+ *	Disk entries record the custom versions they were cooked with and are ignored once any of them changes,
+ *	the directory is kept under SimpleMesh.CollisionCache.MaxDiskMB by deleting the least recently used files.
+ *	Only the game thread talks to the cache, disk writes and trimming happen on the thread pool.
+ */
+class SIMPLEMESHCOMPONENT_API FSimpleMeshCollisionCache
+{
+public:
+    static FSimpleMeshCollisionCache& Get();
+
+    /** Hash the trimesh data as it will be handed to the cooker, 0 when there is nothing to cook */
+    static uint64 ComputeGeometryHash(const FTriMeshCollisionData& CollisionData, uint32 CookFlags);
+
+    /** Fill the body setup with cached cooked geometry, returns false on a miss */
+    bool TryApply(uint64 GeometryHash, UBodySetup* BodySetup);
+
+    /** Remember the geometry a body setup just cooked */
+    void Store(uint64 GeometryHash, const UBodySetup* BodySetup);
+
+    /** Drop every entry held in memory, the disk cache is left alone */
+    void ClearMemory();
+
+    const FSimpleMeshCollisionCacheStats& GetStats() const { return Stats; }
+
+private:
+    static FString GetCacheDirectory();
+
+    /** Where a hash lives on disk */
+    static FString GetCacheFilename(uint64 GeometryHash);
+
+    bool LoadFromDisk(uint64 GeometryHash, TArray<FSimpleMeshTriMeshPtr>& OutTriMeshes) const;
+    void SaveToDisk(uint64 GeometryHash, const TArray<FSimpleMeshTriMeshPtr>& TriMeshes) const;
+
+    /** Delete the least recently used disk entries until the directory fits in SimpleMesh.CollisionCache.MaxDiskMB */
+    void TrimDisk() const;
+
+    void AddToMemory(uint64 GeometryHash, const TArray<FSimpleMeshTriMeshPtr>& TriMeshes);
+
+    /** Cached cooked trimeshes */
+    TMap<uint64, TArray<FSimpleMeshTriMeshPtr>> Entries;
+
+    /** Use order of Entries, least recent first, used for eviction */
+    TArray<uint64> EntryOrder;
+
+    /** Disk writes this session, paces TrimDisk */
+    uint32 NumDiskStores = 0;
+
+    FSimpleMeshCollisionCacheStats Stats;
+};
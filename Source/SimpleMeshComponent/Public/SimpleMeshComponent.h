@@ -8,6 +8,12 @@
 
 #include "CoreMinimal.h"
 #include "SimpleMeshProxy.h"
+#include "SimpleMeshNormals.h"
+#include "SimpleMeshConvexDecomposition.h"
+#include "SimpleMeshBVH.h"
+#include "SimpleMeshVoxel.h"
+#include "SimpleMeshSnapshot.h"
+#include "Misc/ScopeRWLock.h"
 #include "Interfaces/Interface_CollisionDataProvider.h"
 #include "Components/MeshComponent.h"
 #include "Modules/ModuleManager.h"
@@ -16,6 +22,9 @@
 #include "SimpleMeshComponent.generated.h"
 
 struct FKConvexElem;
+class USimpleMeshBuilder;
+
+DECLARE_STATS_GROUP(TEXT("SimpleMesh"), STATGROUP_SimpleMesh, STATCAT_Advanced);
 
 /** One vertex for the Simple mesh, used for storing data internally */
 
@@ -35,6 +44,135 @@ public:
     {}
 };
 
+/** A contiguous run of vertices inside a section. */
+
+USTRUCT(BlueprintType)
+struct FSimpleMeshVertexRange
+{
+    GENERATED_BODY()
+public:
+
+    /** Index of the first vertex of the range */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Vertex)
+        int32 FirstVertex;
+
+    /** Number of vertices in the range */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = Vertex)
+        int32 NumVertices;
+
+    FSimpleMeshVertexRange()
+        : FirstVertex(0)
+        , NumVertices(0)
+    {}
+
+    /** Insert a range in a sorted range list, merging it with every range it overlaps or that is closer than MergeGap vertices */
+    static void AddMerged(TArray<FSimpleMeshVertexRange>& Ranges, int32 FirstVertex, int32 NumVertices, int32 MergeGap);
+};
+
+/** Stable reference to a section. Stays valid until the section is removed, even if other sections come and go. */
+
+USTRUCT(BlueprintType)
+struct FSimpleMeshSectionHandle
+{
+    GENERATED_BODY()
+public:
+
+    /** Slot of the section, the SectionIndex of the index based API */
+    UPROPERTY(BlueprintReadOnly, Category = "Components|SimpleMesh")
+        int32 Index;
+
+    /** Bumped each time the slot is freed, tells a reused slot from the section the handle was made for */
+    UPROPERTY()
+        int32 Generation;
+
+    FSimpleMeshSectionHandle()
+        : Index(INDEX_NONE)
+        , Generation(0)
+    {}
+
+    FSimpleMeshSectionHandle(int32 InIndex, int32 InGeneration)
+        : Index(InIndex)
+        , Generation(InGeneration)
+    {}
+
+    bool operator==(const FSimpleMeshSectionHandle& Other) const { return Index == Other.Index && Generation == Other.Generation; }
+};
+
+/** Closest triangle hit by a ray cast against the sections, in world space */
+
+USTRUCT(BlueprintType)
+struct FSimpleMeshQueryHit
+{
+    GENERATED_BODY()
+public:
+
+    UPROPERTY(BlueprintReadOnly, Category = "Components|SimpleMesh")
+        FVector Location;
+
+    /** Face normal of the hit triangle */
+    UPROPERTY(BlueprintReadOnly, Category = "Components|SimpleMesh")
+        FVector Normal;
+
+    /** Distance from the ray start */
+    UPROPERTY(BlueprintReadOnly, Category = "Components|SimpleMesh")
+        float Distance;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Components|SimpleMesh")
+        int32 SectionIndex;
+
+    /** Triangle of the section, its first index is at TriangleIndex * 3 */
+    UPROPERTY(BlueprintReadOnly, Category = "Components|SimpleMesh")
+        int32 TriangleIndex;
+
+    FSimpleMeshQueryHit()
+        : Location(ForceInit)
+        , Normal(ForceInit)
+        , Distance(0.f)
+        , SectionIndex(INDEX_NONE)
+        , TriangleIndex(INDEX_NONE)
+    {}
+};
+
+/** One triangle of one section */
+
+USTRUCT(BlueprintType)
+struct FSimpleMeshTriangleRef
+{
+    GENERATED_BODY()
+public:
+
+    UPROPERTY(BlueprintReadOnly, Category = "Components|SimpleMesh")
+        int32 SectionIndex;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Components|SimpleMesh")
+        int32 TriangleIndex;
+
+    FSimpleMeshTriangleRef()
+        : SectionIndex(INDEX_NONE)
+        , TriangleIndex(INDEX_NONE)
+    {}
+
+    FSimpleMeshTriangleRef(int32 InSectionIndex, int32 InTriangleIndex)
+        : SectionIndex(InSectionIndex)
+        , TriangleIndex(InTriangleIndex)
+    {}
+};
+
+/** What a section keeps on the CPU once its render data is built */
+
+UENUM(BlueprintType)
+enum class ESimpleMeshSectionRetention : uint8
+{
+    /** Keep every vertex attribute, all the features keep working */
+    KeepAll,
+
+    /** Keep positions and indices only, enough to cook collision again. Deform and queries skip the section. */
+    KeepPositions,
+
+    /** Free everything once on the GPU. Sections with collision keep positions and indices, as with KeepPositions. */
+    Discard,
+};
+
 /** One section of the procedural mesh. Each material has its own section. */
 
 USTRUCT()
@@ -66,21 +204,181 @@ public:
     UPROPERTY()
         bool Visible;
 
+    /** Should normals and tangents be generated from the triangles of this section */
+    UPROPERTY()
+        bool bGenerateNormals;
+
+    /** Can the big triangles of this section hide other primitives, when the component is used as occluder */
+    UPROPERTY()
+        bool bUseAsOccluder;
+
+    /** Should this section cast shadows */
+    UPROPERTY()
+        bool bCastShadow;
+
+    /** Low poly stand-in drawn in the shadow depth passes instead of the section, empty to shadow with the section itself */
+        TArray<FDynamicMeshVertex> ShadowVertexBuffer;
+        TArray<uint32> ShadowIndexBuffer;
+
+    /** Identifies the shadow mesh being simplified, see GenerateSectionShadowMesh */
+        uint32 ShadowMeshSerial = 0;
+
+    /** Triangles cooked for the collision of the section instead of its render triangles, empty to use those */
+        TArray<FVector3f> CollisionVertices;
+        TArray<uint32> CollisionIndices;
+
+    /** The collision mesh was supplied with SetSectionCollisionMesh: moving the vertices keeps it, instead of simplifying them again */
+        bool bCustomCollisionMesh = false;
+
+    /** Identifies the collision mesh being simplified, see GenerateSectionCollisionMesh */
+        uint32 CollisionMeshSerial = 0;
+
+    /** Sorted, merged vertex ranges whose positions still have to be sent to the GPU */
+        TArray<FSimpleMeshVertexRange> DirtyVertexRanges;
+
+    /** Adjacency used to regenerate normals incrementally */
+        FSimpleMeshVertexAdjacency NormalAdjacency;
+
+    /** Triangle hierarchy for queries, built on the first query and shared with copies of the section */
+        TSharedPtr<FSimpleMeshBVH, ESPMode::ThreadSafe> BVH;
+
+    /** Vertices moved since the BVH was built, it is refit before the next query */
+        bool bBVHNeedsRefit = false;
+
+    /** xxHash64 of the positions the section was created or updated from, 0 once they were edited in place */
+        uint64 PositionsHash = 0;
+
+    /** xxHash64 of the triangles the section was created or updated from, 0 if unknown */
+        uint64 IndicesHash = 0;
+
+    /** CPU data kept once the render data is built */
+    UPROPERTY()
+        ESimpleMeshSectionRetention Retention = ESimpleMeshSectionRetention::KeepAll;
+
+    /** Positions left after VertexBuffer was released, read through GetPosition */
+        TArray<FVector3f> RetainedPositions;
+
+    /** Positions and indices a release without RetainedPositions kept for the occluder and the snapshots, see ReleaseGeometry */
+        FSimpleMeshSectionSnapshotPtr ReleasedSnapshot;
+
+    /** The CPU geometry was released: new proxies draw the section from RenderBuffers */
+        bool bGeometryReleased = false;
+
+    /** GPU buffers of the released geometry and of its shadow mesh, shared with the proxies */
+        TSharedPtr<FSimpleMeshSectionBuffers, ESPMode::ThreadSafe> RenderBuffers;
+        TSharedPtr<FSimpleMeshSectionBuffers, ESPMode::ThreadSafe> ShadowRenderBuffers;
+
+    /** Bytes freed by the release */
+        int64 ReleasedBytes = 0;
+
+    /** When SetSectionVisible hid the section (FPlatformTime seconds), 0 while visible */
+        double HiddenTime = 0.0;
+
+    /** The render data was freed after the section stayed hidden, it is rebuilt when the section is shown */
+        bool bEvicted = false;
+
+    /** VertexBuffer and IndexBuffer compressed while evicted, see bCompressHiddenSections */
+        TArray<uint8> CompressedVertices;
+        TArray<uint8> CompressedIndices;
+        int32 NumCompressedVertices = 0;
+        int32 NumCompressedIndices = 0;
+
+    /** Identifies the decompression in flight, see RestoreEvictedSection */
+        uint32 RestoreSerial = 0;
+
     FSimpleMeshSection()
         : SectionLocalBox(ForceInit)
         , bEnableCollision(false)
         , Visible(true)
+        , bGenerateNormals(false)
+        , bUseAsOccluder(true)
+        , bCastShadow(true)
     {}
 
-    /** Reset this section, clear all mesh info. */
+    /** Reset this section, clear all mesh info. Buffers keep their memory for the next geometry. */
     void Reset()
     {
-        VertexBuffer.Empty();
-        IndexBuffer.Empty();
+        VertexBuffer.Reset();
+        IndexBuffer.Reset();
         SectionLocalBox.Init();
         bEnableCollision = false;
         Visible = true;
+        bGenerateNormals = false;
+        bUseAsOccluder = true;
+        bCastShadow = true;
+        ClearShadowMesh();
+        ClearCollisionMesh();
+        DirtyVertexRanges.Empty();
+        NormalAdjacency.Reset();
+        BVH.Reset();
+        bBVHNeedsRefit = false;
+        Retention = ESimpleMeshSectionRetention::KeepAll;
+        PositionsHash = 0;
+        IndicesHash = 0;
+        HiddenTime = 0.0;
+        ClearReleasedGeometry();
+    }
+
+    /** Vertex count, released sections included */
+    int32 GetNumVertices() const { return VertexBuffer.Num() > 0 ? VertexBuffer.Num() : RetainedPositions.Num(); }
+
+    /** Position of a vertex, released sections included */
+    const FVector3f& GetPosition(int32 VertIdx) const { return VertexBuffer.Num() > 0 ? VertexBuffer[VertIdx].Position : RetainedPositions[VertIdx]; }
+
+    /** Forget the release and the eviction, when the section receives new geometry */
+    void ClearReleasedGeometry()
+    {
+        RetainedPositions.Empty();
+        bGeometryReleased = false;
+        RenderBuffers.Reset();
+        ShadowRenderBuffers.Reset();
+        ReleasedSnapshot.Reset();
+        ReleasedBytes = 0;
+        bEvicted = false;
+        CompressedVertices.Empty();
+        CompressedIndices.Empty();
+        NumCompressedVertices = 0;
+        NumCompressedIndices = 0;
+        RestoreSerial = 0;
     }
+
+    /** Go back to shadowing with the section itself */
+    void ClearShadowMesh()
+    {
+        ShadowVertexBuffer.Empty();
+        ShadowIndexBuffer.Empty();
+        ShadowRenderBuffers.Reset();
+        ShadowMeshSerial = 0;
+    }
+
+    /** Does the collision of this section come from its own collision mesh */
+    bool HasCollisionMesh() const { return CollisionIndices.Num() > 0; }
+
+    /** Go back to colliding with the render triangles */
+    void ClearCollisionMesh()
+    {
+        CollisionVertices.Empty();
+        CollisionIndices.Empty();
+        bCustomCollisionMesh = false;
+        CollisionMeshSerial = 0;
+    }
+
+    /**
+     *	Free what Retention does not keep, once RenderSection was built from this geometry: its GPU buffers are kept instead,
+     *	for the proxies created later. Evicted sections are left alone. Returns the bytes freed.
+     *	@param	bKeepOccluderGeometry	The section feeds the occluder: when neither positions nor indices stay, a snapshot of them is kept.
+     */
+    int64 ReleaseGeometry(const FSimpleMeshSceneSection* RenderSection, bool bKeepOccluderGeometry);
+
+    /** CPU memory held by the section */
+    SIZE_T GetAllocatedSize() const;
+
+    /**
+     *	Vertices and indices of the section, released and evicted sections included, for saving and baking.
+     *	Compressed sections are decompressed. A release only keeps positions: those vertices come back with default tangents.
+     *	Returns false when the release kept nothing to rebuild them from.
+     */
+    bool GetCPUGeometry(TArray<FDynamicMeshVertex>& OutVertices, TArray<uint32>& OutIndices) const;
 };
 
 
@@ -120,17 +418,39 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh", meta = (DisplayName = "Remove Mesh Section", AutoCreateRefTerm = ""))
     void RemoveMeshSection(int32 SectionIndex);
 
+    /**
+     *	Create a section in the most recently freed slot (or a new one), O(1). Other sections keep their index.
+     *	@return	Handle of the new section, invalid if Vertices or Triangles is empty.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh", meta = (DisplayName = "Add Mesh Section"))
+    FSimpleMeshSectionHandle AddMeshSection(const TArray<FVector>& Vertices, const TArray<int32>& Triangles, UMaterialInterface* Material, bool bSectionVisible = true, bool bCreateCollision = false);
+
+    /** Remove the section of a handle, does nothing if the section was already removed */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    bool RemoveMeshSectionByHandle(FSimpleMeshSectionHandle Handle);
+
+    /** Handle of the section currently in a slot, invalid if the slot is free */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    FSimpleMeshSectionHandle GetSectionHandle(int32 SectionIndex) const;
+
+    /** Slot of the section of a handle, INDEX_NONE if it was removed */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    int32 GetSectionIndex(FSimpleMeshSectionHandle Handle) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    bool IsSectionHandleValid(FSimpleMeshSectionHandle Handle) const;
+
     /** Clear all mesh sections */
     UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
         void ClearAllMeshSections();
 
-    /** Returns number of sections currently created for this component */
+    /** Returns the number of section slots, removed sections leave a free slot (see DoesSectionExist) until reused */
     UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
     int32 GetNumSections() const;
 
     /** Add simple collision convex to this component */
-    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
-    void AddCollisionConvexMesh(TArray<FVector> ConvexVerts);
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh", meta = (AutoCreateRefTerm = "ConvexVerts"))
+    void AddCollisionConvexMesh(const TArray<FVector>& ConvexVerts);
 
     /** Remove collision meshes from this component */
     UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
@@ -139,6 +459,170 @@ public:
     /** Function to replace _all_ simple collision in one go */
     void SetCollisionConvexMeshes(const TArray< TArray<FVector> >& ConvexMeshes);
 
+    /** Number of vertices handed to each worker by DeformSection/DeformSectionBlocks */
+    static constexpr int32 DeformBlockSize = 1024;
+
+    /**
+     *	Deform the positions of an existing section in place, in parallel across all cores.
+     *	Indices are left untouched, only the GPU position stream is re-uploaded. Sections without CPU vertices (released) are skipped.
+     *	@param	SectionIndex		Index of the section to deform.
+     *	@param	DeformFunc			Called once per vertex with its index in the section and its position. Must be thread safe.
+     *	@param	bUpdateCollision	Recook collision if the section has collision enabled.
+     */
+    void DeformSection(int32 SectionIndex, TFunctionRef<void(int32 VertexIndex, FVector3f& Position)> DeformFunc, bool bUpdateCollision = false);
+
+    /**
+     *	Same as DeformSection but hands contiguous blocks of up to DeformBlockSize positions to the callback,
+     *	so the callback can run vectorized code over tightly packed FVector3f.
+     *	@param	BlockFunc			Called once per block with the index of its first vertex and a view of its positions. Must be thread safe.
+     */
+    void DeformSectionBlocks(int32 SectionIndex, TFunctionRef<void(int32 FirstVertexIndex, TArrayView<FVector3f> Positions)> BlockFunc, bool bUpdateCollision = false);
+
+    /**
+     *	Overwrite the positions of a contiguous run of vertices of an existing section.
+     *	Only the edited vertices are uploaded to the GPU, the cost scales with the edit and not with the section.
+     *	@param	SectionIndex		Index of the section to edit.
+     *	@param	FirstVertex			Index of the first vertex to overwrite.
+     *	@param	Positions			New positions, written from FirstVertex onwards.
+     *	@param	bUpdateCollision	Recook collision if the section has collision enabled.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh", meta = (DisplayName = "Update Mesh Section Vertex Range"))
+    void UpdateMeshSectionVertexRange(int32 SectionIndex, int32 FirstVertex, const TArray<FVector>& Positions, bool bUpdateCollision = false);
+
+    /**
+     *	Sparse version of UpdateMeshSectionVertexRange.
+     *	@param	Ranges				Vertex ranges to overwrite.
+     *	@param	Positions			New positions of all the ranges, packed one range after the other.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh", meta = (DisplayName = "Update Mesh Section Vertex Ranges"))
+    void UpdateMeshSectionVertexRanges(int32 SectionIndex, const TArray<FSimpleMeshVertexRange>& Ranges, const TArray<FVector>& Positions, bool bUpdateCollision = false);
+
+    /**
+     *	Generate smooth normals and tangents for a section from its triangles and keep them up to date
+     *	when its vertices move. Sections created while bGenerateNormals is set do this automatically.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void RecomputeSectionNormals(int32 SectionIndex);
+
+    /**
+     *	Closest triangle of the sections hit by a segment, using the BVH of each section instead of the physics scene.
+     *	Works without collision and sees the positions of the last deform right away.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    bool RaycastSections(FVector Start, FVector End, FSimpleMeshQueryHit& OutHit, bool bVisibleOnly = true);
+
+    /** Every triangle of the sections that intersects a world space box aligned with the component */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    bool OverlapBoxSections(FVector Center, FVector Extent, TArray<FSimpleMeshTriangleRef>& OutTriangles, bool bVisibleOnly = true);
+
+    /** BVH of a section, built or refit if needed. Null for a missing or empty section. */
+    const FSimpleMeshBVH* GetSectionBVH(int32 SectionIndex);
+
+    /**
+     *	Merge the vertices of an existing section closer than Tolerance and drop the triangles that collapse.
+     *	@return		Number of vertices removed.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    int32 WeldMeshSection(int32 SectionIndex, float Tolerance = 0.01f);
+
+    /**
+     *	Replace every section with the mesh of a voxel grid: section N holds the faces of material slot N.
+     *	@param	Mode			Greedy quads for cube voxels, surface nets for smooth terrain.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void MeshVoxelGrid(const FSimpleMeshVoxelGrid& Grid, ESimpleMeshVoxelMode Mode, bool bCreateCollision = false);
+
+    /** MeshVoxelGrid on a worker thread. The sections are replaced on the game thread once ready, unless a newer request was made. */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void MeshVoxelGridAsync(const FSimpleMeshVoxelGrid& Grid, ESimpleMeshVoxelMode Mode, bool bCreateCollision = false);
+
+    /** New builder owned by this component, to assemble a section natively and commit it with CommitToSection */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    USimpleMeshBuilder* CreateMeshBuilder();
+
+    /**
+     *	Create/replace a section with a section built elsewhere, e.g. by USimpleMeshBuilder. Its buffers are moved, not copied.
+     *	Normals are generated if the section asks for them or bGenerateNormals is set.
+     */
+    void CommitMeshSection(int32 SectionIndex, FSimpleMeshSection&& NewSection, UMaterialInterface* Material, bool bSectionVisible = true, bool bCreateCollision = false);
+
+    /** Cook the collision asynchronously now. Called by FSimpleMeshCookScheduler when the turn of this component comes. */
+    void StartAsyncCollisionCook();
+
+    /** Replace every section at once with sections built elsewhere, NewSections[N] goes to slot N. Empty sections leave their slot free. */
+    void ReplaceMeshSections(TArray<FSimpleMeshSection>&& NewSections, bool bCreateCollision);
+
+    /** Show or hide a section. Only a flag of its render data changes, nothing is rebuilt unless the section was released (bReleaseHiddenSections). */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void SetSectionVisible(int32 SectionIndex, bool bNewVisibility);
+
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    bool IsSectionVisible(int32 SectionIndex) const;
+
+    /** False while the render data of a hidden section is released, or being restored */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    bool IsSectionResident(int32 SectionIndex) const;
+
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void SetSectionCastShadow(int32 SectionIndex, bool bNewCastShadow);
+
+    /**
+     *	Give a section a low poly stand-in drawn only in the shadow depth passes, the section itself is drawn in the main pass only.
+     *	Deforms do not move the shadow mesh. Empty arrays remove it.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh", meta = (AutoCreateRefTerm = "Vertices, Triangles"))
+    void SetSectionShadowMesh(int32 SectionIndex, const TArray<FVector>& Vertices, const TArray<int32>& Triangles);
+
+    /** Build the shadow mesh of a section on a worker, by merging its vertices closer than CellSize. Kept only if it saves a quarter of the triangles. */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void GenerateSectionShadowMesh(int32 SectionIndex, float CellSize);
+
+    /**
+     *	Collide with these triangles instead of the render triangles of a section, which must have collision enabled.
+     *	Kept when the section vertices move, dropped when UpdateMeshSection gives the section new triangles. Empty arrays remove it.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh", meta = (AutoCreateRefTerm = "Vertices, Triangles"))
+    void SetSectionCollisionMesh(int32 SectionIndex, const TArray<FVector>& Vertices, const TArray<int32>& Triangles);
+
+    /** Decimate the triangles of a section into its collision mesh on a worker, the collision surface stays within MaxError of the render surface */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void GenerateSectionCollisionMesh(int32 SectionIndex, float MaxError);
+
+    /** Triangles cooked for the collision of a section */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    int32 GetSectionCollisionTriangleCount(int32 SectionIndex) const;
+
+    /** Let a section contribute to the occluder mesh, see bUseAsOccluder */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void SetSectionUseAsOccluder(int32 SectionIndex, bool bSectionUseAsOccluder);
+
+    /** Occluder mesh built from the sections, null until the first build finishes or when bUseAsOccluder is off */
+    TSharedPtr<FSimpleMeshOccluderData, ESPMode::ThreadSafe> GetOccluderData() const { return OccluderData; }
+
+    /** Change what a section keeps on the CPU, applied the next time its render data is built */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void SetSectionRetention(int32 SectionIndex, ESimpleMeshSectionRetention InRetention);
+
+    /** CPU memory held by the sections, and freed by their retention policy */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void GetSectionsMemory(int64& OutAllocatedBytes, int64& OutReleasedBytes) const;
+
+    /**
+     *	Latest published copy of the sections, callable from any thread while the component is alive.
+     *	Readers keep the snapshot, not the component: it stays valid and unchanged however the sections are edited afterwards.
+     *	Null until the first publication, see bPublishSectionSnapshots (occluder builds publish too).
+     */
+    FSimpleMeshSnapshotPtr GetSnapshot() const;
+
+    /** Latest published copy of one section, any thread. Null for a free slot. */
+    FSimpleMeshSectionSnapshotPtr GetSectionSnapshot(int32 SectionIndex) const;
+
+    /** Publish the pending section changes now instead of at the next tick. Game thread. */
+    void PublishSectionSnapshots();
+
+    /** Dirty ranges closer than this many vertices are merged into a single upload */
+    static constexpr int32 DirtyRangeMergeGap = 64;
+
     //~ Begin Interface_CollisionDataProvider Interface
     virtual bool GetTriMeshSizeEstimates(struct FTriMeshCollisionDataEstimates& OutTriMeshEstimates, bool bInUseAllTriData) const override;
     virtual bool GetPhysicsTriMeshData(struct FTriMeshCollisionData* CollisionData, bool InUseAllTriData) override;
@@ -148,6 +632,7 @@ public:
 
 
     virtual void PostLoad() override;
+    virtual void Serialize(FArchive& Ar) override;
 
 
     virtual FPrimitiveSceneProxy* CreateSceneProxy() override;
@@ -157,7 +642,7 @@ public:
    /** Vrifie si une section de mesh spcifie par son index existe. */
     bool DoesSectionExist(int32 SectionIndex) const;
 
-    TArray<FSimpleMeshSection> MeshSections; // Stocke les sections de maillage
+    TSparseArray<FSimpleMeshSection> MeshSections; // Stocke les sections de maillage, un slot libre par section retire
     
     //Collision
 
@@ -167,6 +652,96 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Collision|SimpleMesh")
         bool bUseAsyncCooking;
 
+    /** Reuse cooked collision of identical geometry, from memory or from the local disk cache, instead of cooking again */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Collision|SimpleMesh")
+        bool bUseCollisionCache;
+
+    /** Split the collision sections into convex hulls in the background and use them as simple collision */
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Collision|SimpleMesh", meta = (EditCondition = "!bUseComplexAsSimpleCollision"))
+        bool bAutoGenerateConvexCollision;
+
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Collision|SimpleMesh", meta = (EditCondition = "bAutoGenerateConvexCollision"))
+        FSimpleMeshConvexDecompositionSettings ConvexDecompositionSettings;
+
+    /**
+     *	Collision sections get a collision mesh decimated with GenerateSectionCollisionMesh within this error, 0 collides with the render triangles.
+     *	The collision is cooked once the decimation is done, the previous collision stays until then.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collision|SimpleMesh", meta = (ClampMin = "0", Units = "cm"))
+        float CollisionSimplifyError;
+
+    //Geometry
+
+    /** Merge vertices closer than WeldTolerance when sections are created or updated, before upload and collision */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geometry|SimpleMesh")
+        bool bWeldVertices;
+
+    /** Max distance between merged vertices, 0 only merges identical positions */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geometry|SimpleMesh", meta = (EditCondition = "bWeldVertices", ClampMin = "0"))
+        float WeldTolerance;
+
+    /** Publish immutable copies of the changed sections once per frame, for readers on worker threads (GetSnapshot) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Geometry|SimpleMesh")
+        bool bPublishSectionSnapshots;
+
+    /** Vertices removed by the welds of this component so far */
+    UPROPERTY(Transient, VisibleInstanceOnly, BlueprintReadOnly, Category = "Geometry|SimpleMesh")
+        int32 NumWeldedVertices;
+
+    //Rendering
+
+    /** Generate normals and tangents for new sections, lit materials need them */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering|SimpleMesh")
+        bool bGenerateNormals;
+
+    /** Triangles kept in the occluder mesh when bUseAsOccluder is set, the largest ones first */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering|SimpleMesh", meta = (ClampMin = "0"))
+        int32 OccluderMaxTriangles;
+
+    /** Triangles smaller than this (cm) never go in the occluder mesh */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering|SimpleMesh", meta = (ClampMin = "0"))
+        float OccluderMinTriangleArea;
+
+    /**
+     *	Retention of new sections. Anything but KeepAll frees the CPU vertices once the render data is built: the GPU buffers are kept
+     *	by the component for the proxies recreated later (material change, re-register). With bSerializeMeshSections, editor worlds keep
+     *	everything so levels save the full sections, game worlds save what the release kept.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering|SimpleMesh")
+        ESimpleMeshSectionRetention DefaultSectionRetention;
+
+    /** New geometry gets a shadow mesh simplified with GenerateSectionShadowMesh at this cell size, 0 shadows with the full sections */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering|SimpleMesh", meta = (ClampMin = "0", Units = "cm"))
+        float ShadowMeshCellSize;
+
+    /** In game worlds, free the GPU buffers of sections hidden by SetSectionVisible for HiddenSectionReleaseDelay. They are rebuilt when shown. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering|SimpleMesh")
+        bool bReleaseHiddenSections;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering|SimpleMesh", meta = (EditCondition = "bReleaseHiddenSections", ClampMin = "0", Units = "s"))
+        float HiddenSectionReleaseDelay;
+
+    /**
+     *	Also compress the CPU geometry of released sections without collision, it is decompressed on a worker when they are shown.
+     *	Until then queries and snapshots see them empty.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Rendering|SimpleMesh", meta = (EditCondition = "bReleaseHiddenSections"))
+        bool bCompressHiddenSections;
+
+    //Serialization
+
+    /** Save the section geometry with the component, so it does not have to be regenerated on load */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Serialization|SimpleMesh")
+        bool bSerializeMeshSections;
+
+    /** Store positions on 16 bits per component inside each section box (half the size, precision of box size / 65535) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Serialization|SimpleMesh", meta = (EditCondition = "bSerializeMeshSections"))
+        bool bQuantizeSerializedPositions;
+
+    /** Compress the saved geometry */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Serialization|SimpleMesh", meta = (EditCondition = "bSerializeMeshSections"))
+        bool bCompressSerializedSections;
+
     //Material
 
     UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Material|SimpleMesh")
@@ -188,13 +763,99 @@ public:
 
 protected:
 	
-    void UpdateLocalBounds(); // Mise  jour des limites locales bases sur les sections de maillage
+    //~ Begin UActorComponent Interface.
+    virtual void SendRenderDynamicData_Concurrent() override;
+    //~ End UActorComponent Interface.
+
+    void UpdateLocalBounds(bool bPositionsOnly = false); // Mise  jour des limites locales bases sur les sections de maillage, bPositionsOnly pour les dformations
 
 
 private:
    
     FBoxSphereBounds LocalBounds; // Limites locales du maillage
 
+    /** Store the new section box, refresh bounds and push the deformed positions to the render thread. No-op without CPU vertices. */
+    void FinishSectionDeform(int32 SectionIndex, const FBox3f& SectionBox, bool bUpdateCollision);
+
+    /** Queue a vertex range of a section for upload at the end of the frame, merging it with the pending ones */
+    void MarkSectionPositionsDirty(int32 SectionIndex, int32 FirstVertex, int32 NumVertices);
+
+    /** Bring the generated normals of a section up to date with its dirty ranges */
+    void FlushSectionNormals(FSimpleMeshSection& Section);
+
+    /** Bounding box of all the vertices of a section, computed in parallel */
+    static FBox ComputeSectionBox(const FSimpleMeshSection& Section);
+
+    /** Rebuild the render data of one slot only, or the whole proxy if it is about to be recreated anyway */
+    void UpdateSectionProxy(int32 SectionIndex);
+
+    /** Apply the retention policy of a section once RenderSection was built from it */
+    void ReleaseSectionGeometry(FSimpleMeshSection& Section, const FSimpleMeshSceneSection* RenderSection);
+
+    /** Weld freshly ingested geometry if bWeldVertices is set */
+    void WeldIngestedSection(FSimpleMeshSection& Section);
+
+
+    /** Copy a section again at the next publication */
+    void MarkSectionSnapshotStale(int32 SectionIndex);
+
+    /** Free the render data of a section hidden at HiddenTime, unless it was shown since */
+    void EvictHiddenSection(int32 SectionIndex, double HiddenTime);
+
+    /** Rebuild the render data of an evicted section, its geometry is decompressed on a worker first if needed */
+    void RestoreEvictedSection(int32 SectionIndex);
+
+    /** Game thread end of a decompression, ignored if the section changed meanwhile */
+    void FinishRestoreSection(int32 SectionIndex, uint32 Serial, TArray<FDynamicMeshVertex>&& Vertices, TArray<uint32>&& Indices);
+
+    /** Source of FSimpleMeshSection::RestoreSerial */
+    uint32 SectionRestoreSerial = 0;
+
+    /** Simplify new geometry into its shadow mesh if ShadowMeshCellSize is set */
+    void RequestSectionShadowMesh(int32 SectionIndex);
+
+    /** Game thread end of GenerateSectionShadowMesh, ignored if the section changed meanwhile */
+    void FinishSectionShadowMesh(int32 SectionIndex, uint32 Serial, TArray<FDynamicMeshVertex>&& Vertices, TArray<uint32>&& Indices);
+
+    /** Hand the shadow mesh of a section to the proxy, the render data of the section itself is kept */
+    void UpdateSectionShadowProxy(int32 SectionIndex);
+
+    /** Source of FSimpleMeshSection::ShadowMeshSerial */
+    uint32 ShadowMeshSerialCounter = 0;
+
+    /** Decimate the collision of a section if CollisionSimplifyError is set. @return True if a decimation started. */
+    bool RequestSectionCollisionMesh(int32 SectionIndex);
+
+    /** Game thread end of GenerateSectionCollisionMesh, ignored if the section changed meanwhile */
+    void FinishSectionCollisionMesh(int32 SectionIndex, uint32 Serial, TArray<FVector3f>&& Vertices, TArray<uint32>&& Indices);
+
+    /** A collision section is being decimated, its collision is cooked once that is done */
+    bool HasPendingCollisionMeshes() const;
+
+    /** Source of FSimpleMeshSection::CollisionMeshSerial */
+    uint32 CollisionMeshSerialCounter = 0;
+
+    /** Sections changed since the last publication */
+    TBitArray<> StaleSnapshots;
+
+    /** Every section changed, e.g. after ClearAllMeshSections */
+    bool bAllSnapshotsStale = true;
+
+    /** A publication is scheduled for the next tick */
+    bool bSnapshotPublishPending = false;
+
+    uint32 SnapshotVersion = 0;
+
+    /** Only the pointer swap is guarded, readers copy the pointer and never wait on a copy being made */
+    mutable FRWLock SnapshotLock;
+    FSimpleMeshSnapshotPtr PublishedSnapshot;
+
+    /** Invalidate the handles of a slot */
+    void BumpSectionGeneration(int32 SectionIndex);
+
+    /** Generation of each slot, see FSimpleMeshSectionHandle */
+    TArray<int32> SectionGenerations;
+
     /** Ensure ProcMeshBodySetup is allocated and configured */
     void CreateSimpleMeshBodySetup();
 
@@ -204,16 +865,90 @@ private:
     /** Mark collision data as dirty, and re-create on instance if necessary */
     void UpdateCollision();
 
-    void FinishPhysicsAsyncCook(bool bSuccess, UBodySetup* FinishedBodySetup);
+    void FinishPhysicsAsyncCook(bool bSuccess, UBodySetup* FinishedBodySetup, uint64 GeometryHash, int32 NumAutoConvexElems);
+
+    /** Every convex element fed to a cook, generated hulls included, should come back cooked: a stale cooked entry would not. Logs the ones that did not. */
+    void VerifyCookedConvexElems(const UBodySetup* CookedBodySetup, int32 NumAutoConvexElems) const;
+
+    /** Fill a body setup with the current collision and cook it, from the collision cache if possible */
+    void CookCollision(UBodySetup* UseBodySetup, bool bUseAsyncCook);
+
+    /** Body setup for the next async cook, recycled from BodySetupPool when possible */
+    UBodySetup* AcquireBodySetup();
+
+    /** Give back a body setup nothing uses anymore */
+    void RecycleBodySetup(UBodySetup* BodySetup);
+
+    /**
+     *	Give back the body setup SimpleMeshBodySetup replaced. The proxy draws its collision on the render thread:
+     *	it is handed the new setup first, the previous one is recycled once the render thread moved on.
+     */
+    void RetireBodySetup(UBodySetup* BodySetup);
+
+    /** Body setups kept for the next async cooks */
+    static constexpr int32 MaxPooledBodySetups = 2;
+
+    /** Gather the trimesh that would be cooked right now and hash it, 0 if there is none */
+    uint64 ComputeCollisionGeometryHash(FTriMeshCollisionData& OutCollisionData);
+
+    /** GUID of a body setup holding the trimesh of GeometryHash and these convex elements, the DDC key of its cook */
+    static FGuid MakeBodySetupGuid(uint64 GeometryHash, const TArray<FKConvexElem>& ConvexElems);
+
+    /** Start decomposing the collision geometry into hulls if it changed since the last decomposition */
+    void RequestConvexDecomposition(uint64 GeometryHash, FTriMeshCollisionData&& CollisionData);
+
+    /** Game thread end of a decomposition, ignored if a newer one was requested meanwhile */
+    void FinishConvexDecomposition(uint32 Serial, TArray<TArray<FVector>>&& Hulls);
 
     /** Convex shapes used for simple collision */
     UPROPERTY()
         TArray<FKConvexElem> CollisionConvexElems;
 
+    /** Convex shapes generated by the automatic decomposition, added to CollisionConvexElems */
+    UPROPERTY(Transient)
+        TArray<FKConvexElem> AutoConvexElems;
+
+    /** Geometry the automatic hulls were (or are being) generated from */
+    uint64 DecomposedGeometryHash = 0;
+
+    /** Identifies the latest decomposition request */
+    uint32 ConvexDecompositionSerial = 0;
+
+    /** Identifies the latest MeshVoxelGridAsync request, older results are dropped */
+    uint32 VoxelMeshSerial = 0;
+
+    /** Build the occluder mesh on a worker from the section snapshots, at most one build runs at a time */
+    void RequestOccluderUpdate();
+
+    /** Vertices moved: build the occluder mesh once SimpleMesh.OccluderDeformDelay has passed, edits until then share the build */
+    void DeferOccluderUpdate();
+
+    /** Store a finished occluder mesh and hand it to the proxy */
+    void FinishOccluderUpdate(TSharedPtr<FSimpleMeshOccluderData, ESPMode::ThreadSafe> NewOccluderData);
+
+    /** Latest occluder mesh, shared with the proxy */
+    TSharedPtr<FSimpleMeshOccluderData, ESPMode::ThreadSafe> OccluderData;
+
+    bool bOccluderBuildInFlight = false;
+
+    /** Geometry changed while a build was running, build again when it finishes */
+    bool bOccluderDirty = false;
+
+    /** A DeferOccluderUpdate timer is pending */
+    bool bOccluderUpdateDeferred = false;
+
     /** Queue for async body setups that are being cooked */
     UPROPERTY(transient)
         TArray<TObjectPtr<UBodySetup>> AsyncBodySetupQueue;
 
+    /** Emptied body setups of previous cooks, reused instead of creating one per cook */
+    UPROPERTY(transient)
+        TArray<TObjectPtr<UBodySetup>> BodySetupPool;
+
+    /** Replaced body setups the proxy may still be reading, see RetireBodySetup */
+    UPROPERTY(transient)
+        TArray<TObjectPtr<UBodySetup>> RetiringBodySetups;
+
 };
 
 // Scene Proxy to RenderThread
@@ -222,28 +957,74 @@ class FSimpleSceneProxy : public FSimpleMeshSceneProxy
 {
 public:
   
-    FSimpleSceneProxy(USimpleMeshComponent* Component) :
-        FSimpleMeshSceneProxy(Component)
+    /**
+     *	Sections are prepared in parallel above SimpleMesh.Proxy.ParallelSectionThreshold sections,
+     *	their render resources are initialized by a single render command.
+     */
+    FSimpleSceneProxy(USimpleMeshComponent* Component);
+
+    /** Render data the constructor built for a section slot, game thread until the proxy is added to the scene */
+    const FSimpleMeshSceneSection* GetSceneSection(int32 SectionIndex) const
+    {
+        return Sections.IsValidIndex(SectionIndex) ? Sections[SectionIndex] : nullptr;
+    }
+
+    /** Render data of a section, null if it has nothing to draw. Game thread. */
+    FSimpleMeshSceneSection* CreateSceneSection(USimpleMeshComponent* Component, FSimpleMeshSection& MeshSection) const
+    {
+        return CreateSceneSection(Component, MeshSection, Component->GetMaterial(MeshSection.MaterialIndex), false);
+    }
+
+    /**
+     *	Same with the material already resolved. With bDeferResourceInit no UObject is touched and nothing is enqueued,
+     *	any thread may call it: the caller initializes the resources of the section and of its shadow section.
+     */
+    FSimpleMeshSceneSection* CreateSceneSection(const USimpleMeshComponent* Component, FSimpleMeshSection& MeshSection, UMaterialInterface* Material, bool bDeferResourceInit) const
     {
-        int32 SectionCnt = Component->MeshSections.Num();
-        Sections.AddZeroed(SectionCnt);
-        ERHIFeatureLevel::Type FL = GetScene().GetFeatureLevel();
-        bShouldRenderStatic = !IsMovable();
+        // Released sections are drawn from the buffers their component kept
+        const bool bFromRenderBuffers = MeshSection.bGeometryReleased && MeshSection.RenderBuffers.IsValid();
+        const bool bFromGeometry = MeshSection.VertexBuffer.Num() >= 3 && MeshSection.IndexBuffer.Num() >= 3 && MeshSection.IndexBuffer.Num() % 3 == 0;
+        if (MeshSection.bEvicted || !(bFromRenderBuffers || bFromGeometry))
+        {
+            return nullptr;
+        }
+
         FSimpleMeshSectionOptions Options;
-        Options.bCastsShadow = true;
+        Options.bCastsShadow = MeshSection.bCastShadow;
         Options.bIsMainPassRenderable = Component->bRenderInMainPass;
         Options.bShouldRenderStatic = bShouldRenderStatic;
+        Options.bIsVisible = MeshSection.Visible;
 
-        for (int i = 0; i < SectionCnt; i++)
-        {
-            FSimpleMeshSection& MeshSection = Component->MeshSections[i];
-            Options.bIsVisible = MeshSection.Visible;
-            Sections[i] = new FSimpleMeshSceneSection(MeshSection.VertexBuffer, MeshSection.IndexBuffer,
-                Component->GetMaterial(MeshSection.MaterialIndex), Options, FL);
+        FSimpleMeshSceneSection* SceneSection = bFromGeometry
+            ? new FSimpleMeshSceneSection(MeshSection.VertexBuffer, MeshSection.IndexBuffer, Material, Options, GetScene().GetFeatureLevel(), 0, MAX_TEXCOORDS, bDeferResourceInit)
+            : new FSimpleMeshSceneSection(MeshSection.RenderBuffers, Material, Options, GetScene().GetFeatureLevel(), 0, bDeferResourceInit);
+        SceneSection->ShadowSection = CreateShadowSceneSection(MeshSection, Material, bDeferResourceInit);
+        return SceneSection;
+    }
 
+    /** Render data of the shadow mesh of a section, null if it has none. Game thread. */
+    FSimpleMeshSceneSection* CreateShadowSceneSection(USimpleMeshComponent* Component, FSimpleMeshSection& MeshSection) const
+    {
+        return CreateShadowSceneSection(MeshSection, Component->GetMaterial(MeshSection.MaterialIndex), false);
+    }
+
+    FSimpleMeshSceneSection* CreateShadowSceneSection(FSimpleMeshSection& MeshSection, UMaterialInterface* Material, bool bDeferResourceInit) const
+    {
+        const bool bFromGeometry = MeshSection.ShadowVertexBuffer.Num() >= 3 && MeshSection.ShadowIndexBuffer.Num() >= 3 && MeshSection.ShadowIndexBuffer.Num() % 3 == 0;
+        if (!bFromGeometry && !MeshSection.ShadowRenderBuffers.IsValid())
+        {
+            return nullptr;
         }
 
-        SectionsUpdated();
+        FSimpleMeshSectionOptions Options;
+        Options.bCastsShadow = true;
+        Options.bIsShadowOnly = true;
+        Options.bShouldRenderStatic = bShouldRenderStatic;
+        Options.bIsVisible = true;
+
+        return bFromGeometry
+            ? new FSimpleMeshSceneSection(MeshSection.ShadowVertexBuffer, MeshSection.ShadowIndexBuffer, Material, Options, GetScene().GetFeatureLevel(), 0, MAX_TEXCOORDS, bDeferResourceInit)
+            : new FSimpleMeshSceneSection(MeshSection.ShadowRenderBuffers, Material, Options, GetScene().GetFeatureLevel(), 0, bDeferResourceInit);
     }
 };
 
@@ -7,3 +7,51 @@
 
 #pragma once
 
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "SimpleMeshConversion.generated.h"
+
+class USimpleMeshComponent;
+class UStaticMesh;
+struct FMeshDescription;
+struct FStaticMaterial;
+
+namespace SimpleMeshConversion
+{
+    /** Name of the material slot used for a material index of the component */
+    SIMPLEMESHCOMPONENT_API FName GetMaterialSlotName(int32 MaterialIndex);
+
+    /**
+     *	Fill a mesh description with the visible sections of a component, one polygon group per material slot.
+     *	Vertex attributes of each section are filled in parallel. Sections without generated normals get them computed.
+     *	Released sections are rebuilt from the positions they kept, with normals computed.
+     *	@return false if the component has no triangles, or a visible section kept no CPU geometry.
+     */
+    SIMPLEMESHCOMPONENT_API bool BuildMeshDescription(const USimpleMeshComponent* Component, FMeshDescription& OutMeshDescription);
+
+    /** Material slots matching the polygon groups written by BuildMeshDescription */
+    SIMPLEMESHCOMPONENT_API void GetStaticMaterials(const USimpleMeshComponent* Component, TArray<FStaticMaterial>& OutMaterials);
+
+    /** Copy the simple collision and the collision trace mode of the component to a static mesh */
+    SIMPLEMESHCOMPONENT_API void CopyCollision(USimpleMeshComponent* Component, UStaticMesh* StaticMesh);
+}
+
+/** Freeze procedural geometry into regular static meshes */
+
+UCLASS()
+class SIMPLEMESHCOMPONENT_API USimpleMeshConversionLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+
+    /**
+     *	Build a transient static mesh from the current geometry of a component, usable at runtime.
+     *	@param	Component			Component to bake.
+     *	@param	Outer				Owner of the new mesh, the transient package if none.
+     *	@param	bAllowCPUAccess		Keep a CPU copy of the geometry, needed for complex collision at runtime.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    static UStaticMesh* BakeToStaticMesh(USimpleMeshComponent* Component, UObject* Outer = nullptr, bool bAllowCPUAccess = true);
+};
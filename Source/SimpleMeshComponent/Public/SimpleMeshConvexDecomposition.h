@@ -0,0 +1,55 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHCONVEXDECOMPOSITION---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHCONVEXDECOMPOSITION---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SimpleMeshConvexDecomposition.generated.h"
+
+/** Limits of the automatic convex decomposition used for simple collision */
+
+USTRUCT(BlueprintType)
+struct SIMPLEMESHCOMPONENT_API FSimpleMeshConvexDecompositionSettings
+{
+    GENERATED_BODY()
+public:
+
+    /** Maximum number of hulls generated for the whole component */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collision|SimpleMesh", meta = (ClampMin = "1", ClampMax = "256"))
+        int32 MaxHullCount;
+
+    /** Maximum number of vertices of each hull */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collision|SimpleMesh", meta = (ClampMin = "6", ClampMax = "255"))
+        int32 MaxHullVertices;
+
+    /** Pieces whose surface is closer than this to their hull are not split any further */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collision|SimpleMesh", meta = (ClampMin = "0"))
+        float ConcavityTolerance;
+
+    /** Flat pieces (terrain, walls) are given this thickness behind their surface so they make a valid hull */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Collision|SimpleMesh", meta = (ClampMin = "0.1"))
+        float MinHullThickness;
+
+    FSimpleMeshConvexDecompositionSettings()
+        : MaxHullCount(16)
+        , MaxHullVertices(32)
+        , ConcavityTolerance(5.f)
+        , MinHullThickness(10.f)
+    {}
+};
+
+namespace SimpleMeshConvexDecomposition
+{
+    /**
+     *	Split a triangle soup into convex pieces and return the points of each hull.
+     *	Pieces are split recursively, most concave first, along the axis plane that reduces concavity the most.
+     *	Concavity of a piece is how deep its surface sinks inside its bounding k-DOP. Safe to call from any thread.
+     */
+    SIMPLEMESHCOMPONENT_API void Decompose(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices,
+        const FSimpleMeshConvexDecompositionSettings& Settings, TArray<TArray<FVector>>& OutHulls);
+}
@@ -0,0 +1,77 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHCOOKSCHEDULER---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHCOOKSCHEDULER---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/Ticker.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+
+class USimpleMeshComponent;
+
+/** Counters of the cook scheduler since startup */
+struct FSimpleMeshCookSchedulerStats
+{
+    /** UpdateCollision calls that asked for an async cook */
+    int32 Requested = 0;
+
+    /** Cooks started, requests made while a cook was pending are folded into it */
+    int32 Executed = 0;
+
+    /** Cooks aborted or failed before their result was used */
+    int32 Aborted = 0;
+};
+
+/**
+ *	Plugin wide queue of the async collision cooks of the components.
+ *	A request is debounced per component: it is cooked once it stopped changing for SimpleMesh.Cook.DebounceTime,
+ *	or after SimpleMesh.Cook.MaxDelay for components updated every frame. At most SimpleMesh.Cook.MaxConcurrent cooks
+ *	run at once, the components closest to a player go first, and a component never has more than one cook running.
+ *	Game thread only.
+ */
+class SIMPLEMESHCOMPONENT_API FSimpleMeshCookScheduler
+{
+public:
+    static FSimpleMeshCookScheduler& Get();
+
+    /** Cook the collision of Component soon, the component is called back through StartAsyncCollisionCook */
+    void RequestCook(USimpleMeshComponent* Component);
+
+    /** Forget the request and the running cook of a component, e.g. when it cooks synchronously instead */
+    void CancelCook(USimpleMeshComponent* Component);
+
+    /** The cook started for Component is over, successful or not */
+    void NotifyCookFinished(USimpleMeshComponent* Component, bool bSuccess);
+
+    /** Components waiting for their turn */
+    int32 GetNumPending() const { return Pending.Num(); }
+
+    /** Cooks running */
+    int32 GetNumInFlight() const { return InFlight.Num(); }
+
+    const FSimpleMeshCookSchedulerStats& GetStats() const { return Stats; }
+
+private:
+    struct FPendingCook
+    {
+        /** First request since the last cook, bounds the wait of components updated every frame */
+        double FirstRequestTime = 0.0;
+
+        /** Latest request, the debounce restarts from it */
+        double LastRequestTime = 0.0;
+    };
+
+    bool Tick(float DeltaTime);
+
+    TMap<TWeakObjectPtr<USimpleMeshComponent>, FPendingCook> Pending;
+
+    TSet<TWeakObjectPtr<USimpleMeshComponent>> InFlight;
+
+    FTSTicker::FDelegateHandle TickHandle;
+
+    FSimpleMeshCookSchedulerStats Stats;
+};
@@ -0,0 +1,92 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHHEIGHTMAP---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHHEIGHTMAP---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class IMappedFileHandle;
+class IMappedFileRegion;
+struct FSimpleMeshSection;
+
+/** Rows of a heightmap mapped for reading, see FSimpleMeshHeightmap::MapRows */
+struct FSimpleMeshHeightmapRows
+{
+    const uint16* Data = nullptr;
+    int32 FirstRow = 0;
+    int32 NumRows = 0;
+    int32 Width = 0;
+
+    /** Pixel value, coordinates are clamped to the mapped rows */
+    uint16 Get(int32 X, int32 Y) const
+    {
+        X = FMath::Clamp(X, 0, Width - 1);
+        Y = FMath::Clamp(Y - FirstRow, 0, NumRows - 1);
+        return Data[(int64)Y * Width + X];
+    }
+
+private:
+    friend class FSimpleMeshHeightmap;
+    IMappedFileRegion* Region = nullptr;
+};
+
+/**
+ *	16-bit heightmap read through a memory mapped file: only the rows being read are mapped, the OS pages them in and out.
+ *	Raw files (.r16/.raw) are little endian, row major, without header. PNG-16 is compressed and cannot be mapped:
+ *	it is decoded once into a raw cache under Saved/SimpleMeshHeightmapCache, which is then mapped on every later open.
+ *	Heights follow the Landscape convention: 32768 is 0, Scale.Z = 100 spans -256..256 m.
+ *	Reading is thread safe.
+ */
+class SIMPLEMESHCOMPONENT_API FSimpleMeshHeightmap
+{
+public:
+
+    /** Open by extension. For raw files a Width of 0 takes the largest square the file holds. */
+    static TSharedPtr<FSimpleMeshHeightmap, ESPMode::ThreadSafe> Open(const FString& Filename, int32 Width = 0, int32 Height = 0);
+
+    static TSharedPtr<FSimpleMeshHeightmap, ESPMode::ThreadSafe> OpenRaw(const FString& Filename, int32 Width, int32 Height);
+
+    /** Decodes the PNG the first time: needs the ImageWrapper module, load it on the game thread before opening from a worker */
+    static TSharedPtr<FSimpleMeshHeightmap, ESPMode::ThreadSafe> OpenPNG(const FString& Filename);
+
+    ~FSimpleMeshHeightmap();
+
+    int32 GetWidth() const { return Width; }
+    int32 GetHeight() const { return Height; }
+
+    /** Map rows [FirstRow, FirstRow + NumRows), clamped to the heightmap. Each successful call needs its UnmapRows. */
+    bool MapRows(int32 FirstRow, int32 NumRows, FSimpleMeshHeightmapRows& OutRows) const;
+
+    void UnmapRows(FSimpleMeshHeightmapRows& Rows) const;
+
+    /** Tiles of NumQuads x NumQuads pixels along each side, the last ones may be smaller */
+    FIntPoint GetNumTiles(int32 NumQuads) const;
+
+    /**
+     *	Build the section of one tile straight from the mapped rows: positions relative to pixel (0, 0), normals from the
+     *	heights around each vertex so they match across tiles, UVs over the whole heightmap. Neighbor tiles share their edge pixels.
+     *	@param	Scale	Centimeters per pixel in X and Y, Landscape Z scale in Z.
+     */
+    bool BuildTileSection(FIntPoint Tile, int32 NumQuads, const FVector& Scale, FSimpleMeshSection& OutSection) const;
+
+private:
+
+    FSimpleMeshHeightmap() = default;
+
+    static TSharedPtr<FSimpleMeshHeightmap, ESPMode::ThreadSafe> OpenMapped(const FString& Filename, int64 DataOffset, int32 Width, int32 Height);
+
+    TUniquePtr<IMappedFileHandle> MappedFile;
+
+    /** Bytes before the first pixel, the header of the PNG cache */
+    int64 DataOffset = 0;
+
+    int32 Width = 0;
+    int32 Height = 0;
+
+    /** Mapping and unmapping go through the file handle, which is not thread safe */
+    mutable FCriticalSection MappingLock;
+};
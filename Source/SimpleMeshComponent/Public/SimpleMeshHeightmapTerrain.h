@@ -0,0 +1,139 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHHEIGHTMAPTERRAIN---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHHEIGHTMAPTERRAIN---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+#include "SimpleMeshComponent.h"
+
+#include "SimpleMeshHeightmapTerrain.generated.h"
+
+class FSimpleMeshHeightmap;
+
+/**
+ *	Terrain streamed from a large 16-bit heightmap, one component per tile of the heightmap.
+ *	The heightmap is memory mapped (see FSimpleMeshHeightmap): tiles are built on worker threads straight from the mapped rows
+ *	into section storage, nearest first, and removed once out of range. Neither the whole heightmap nor the whole mesh is ever loaded.
+ *	Each tile has its own body, loading or unloading a tile only cooks the collision of that tile.
+ */
+UCLASS()
+class SIMPLEMESHCOMPONENT_API ASimpleMeshHeightmapTerrain : public AActor
+{
+    GENERATED_BODY()
+
+public:
+    ASimpleMeshHeightmapTerrain();
+
+    virtual void Tick(float DeltaTime) override;
+
+    /** Open HeightmapFile again and rebuild the tiles around the viewer */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    void ReloadHeightmap();
+
+    UFUNCTION(BlueprintPure, Category = "Components|SimpleMesh")
+    int32 GetNumLoadedTiles() const;
+
+    /** Root of the tiles, every tile component takes its mobility and collision settings */
+    UPROPERTY(VisibleDefaultsOnly, BlueprintReadOnly, Category = "SMC | Mesh Parameters")
+    USimpleMeshComponent* SimpleMeshComponent;
+
+    /** .r16/.raw (little endian, no header) or 16-bit PNG, relative to the project directory or absolute */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Heightmap", meta = (FilePathFilter = "Heightmaps (*.r16;*.raw;*.png)|*.r16;*.raw;*.png"))
+        FFilePath HeightmapFile;
+
+    /** Pixels per row of a raw heightmap, 0 for a square one */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Heightmap", meta = (ClampMin = "0"))
+        int32 RawWidth = 0;
+
+    /** Rows of a raw heightmap, 0 to take every row the file holds */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Heightmap", meta = (ClampMin = "0"))
+        int32 RawHeight = 0;
+
+    /** Centimeters per pixel in X and Y, Landscape Z scale in Z (100 spans -256..256 m) */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Heightmap")
+        FVector HeightmapScale = FVector(100.0, 100.0, 100.0);
+
+    /** Quads along each side of a tile */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Streaming", meta = (ClampMin = "1", ClampMax = "1024"))
+        int32 TileQuads = 128;
+
+    /** Tiles closer than this to the viewer are loaded */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Streaming", meta = (ClampMin = "0", Units = "cm"))
+        float LoadRadius = 25600.f;
+
+    /** Tiles further than this are removed, keep it above LoadRadius to avoid churn */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Streaming", meta = (ClampMin = "0", Units = "cm"))
+        float UnloadRadius = 32000.f;
+
+    /** Tiles being built on workers at once */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Streaming", meta = (ClampMin = "1"))
+        int32 MaxConcurrentTileBuilds = 8;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Streaming")
+        bool bTileCollision = true;
+
+    /** A tile that could not be read is tried again after this delay, while still in range */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Streaming", meta = (ClampMin = "0", Units = "s"))
+        float TileRetryDelay = 5.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Material")
+        UMaterialInterface* Material;
+
+protected:
+    virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+private:
+
+    struct FHeightmapTile
+    {
+        /** Null while the tile is being built, or after its build failed */
+        USimpleMeshComponent* Component = nullptr;
+
+        /** World time after which a failed tile is built again, 0 while it has not failed */
+        double RetryTime = 0.0;
+    };
+
+    /** Remove every tile and forget the heightmap, builds in flight are dropped */
+    void ResetTiles();
+
+    /** Game thread end of the asynchronous open */
+    void FinishOpenHeightmap(uint32 Serial, TSharedPtr<FSimpleMeshHeightmap, ESPMode::ThreadSafe> NewHeightmap);
+
+    /** Game thread end of a tile build, ignored if the tile was unloaded or the heightmap reloaded meanwhile */
+    void FinishTile(uint32 Serial, FIntPoint Tile, bool bBuilt, FSimpleMeshSection&& Section);
+
+    /** Distance from a local position to a tile, in the plane of the terrain */
+    double GetTileDistance(const FVector& LocalLocation, const FIntPoint& Tile) const;
+
+    /** Player view in the space of the terrain */
+    bool GetLocalViewLocation(FVector& OutLocation) const;
+
+    /** Tile component from the pool, or a new one attached to SimpleMeshComponent */
+    USimpleMeshComponent* AcquireTileComponent();
+
+    /** Clear a tile component and return it to the pool */
+    void ReleaseTileComponent(USimpleMeshComponent* Component);
+
+    TSharedPtr<FSimpleMeshHeightmap, ESPMode::ThreadSafe> Heightmap;
+
+    TMap<FIntPoint, FHeightmapTile> Tiles;
+
+    int32 NumTilesBuilding = 0;
+
+    /** Bumped by ResetTiles, tells the results of a previous heightmap apart */
+    uint32 StreamSerial = 0;
+
+    /** Components of the loaded tiles, kept here for the garbage collector */
+    UPROPERTY(Transient)
+        TArray<TObjectPtr<USimpleMeshComponent>> TileComponents;
+
+    /** Components of unloaded tiles, cleared and ready for the next tiles */
+    UPROPERTY(Transient)
+        TArray<TObjectPtr<USimpleMeshComponent>> TileComponentPool;
+};
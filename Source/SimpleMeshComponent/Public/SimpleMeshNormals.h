@@ -0,0 +1,54 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHNORMALS---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHNORMALS---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FSimpleMeshSection;
+struct FSimpleMeshVertexRange;
+
+/** Vertex -> triangle adjacency of a section plus its cached face normals, rebuilt when the topology changes. */
+struct SIMPLEMESHCOMPONENT_API FSimpleMeshVertexAdjacency
+{
+    /** For each vertex, where its incident triangles start in Triangles (NumVertices + 1 entries) */
+    TArray<int32> Offsets;
+
+    /** Incident triangles of every vertex, packed one vertex after the other */
+    TArray<int32> Triangles;
+
+    /** Area weighted normal of every triangle */
+    TArray<FVector3f> FaceNormals;
+
+    /** Build the adjacency from an index buffer */
+    void Build(int32 NumVertices, const TArray<uint32>& Indices);
+
+    /** Does this adjacency match a section of this size */
+    bool IsValid(int32 NumVertices, int32 NumIndices) const
+    {
+        return Offsets.Num() == NumVertices + 1 && FaceNormals.Num() == NumIndices / 3;
+    }
+
+    void Reset()
+    {
+        Offsets.Empty();
+        Triangles.Empty();
+        FaceNormals.Empty();
+    }
+};
+
+namespace SimpleMeshNormals
+{
+    /** Recompute the normals and tangents of every vertex of a section, in parallel. */
+    SIMPLEMESHCOMPONENT_API void ComputeSectionNormals(FSimpleMeshSection& Section);
+
+    /**
+     *	Recompute only the normals affected by moving the vertices of DirtyRanges: the faces around them and every vertex of those faces.
+     *	DirtyRanges is extended with the vertices whose tangents changed, so they get uploaded along with the positions.
+     */
+    SIMPLEMESHCOMPONENT_API void UpdateSectionNormals(FSimpleMeshSection& Section, TArray<FSimpleMeshVertexRange>& DirtyRanges);
+}
@@ -0,0 +1,33 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHOCCLUDER---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHOCCLUDER---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PrimitiveSceneProxy.h"
+#include "SimpleMeshSnapshot.h"
+
+/** Occluder mesh of a component, in the format the software occlusion reads from the proxy */
+struct SIMPLEMESHCOMPONENT_API FSimpleMeshOccluderData
+{
+    FOccluderVertexArraySP VerticesSP;
+    FOccluderIndexArraySP IndicesSP;
+
+    int32 GetNumTriangles() const { return IndicesSP.IsValid() ? IndicesSP->Num() / 3 : 0; }
+};
+
+namespace SimpleMeshOccluder
+{
+    /**
+     *	Keep the largest triangles of the sections as occluder. A subset of the real surface never hides something that is visible.
+     *	Sections are read from their snapshots and scanned in parallel, safe to call from a worker thread.
+     *	@param	MaxTriangles		Triangles kept, the occluder indices are 16 bits so vertices are capped at 65535 too.
+     *	@param	MinTriangleArea		Smaller triangles hide too little to be worth rasterizing.
+     *	@return						Null if no triangle qualifies.
+     */
+    SIMPLEMESHCOMPONENT_API TSharedPtr<FSimpleMeshOccluderData, ESPMode::ThreadSafe> Build(TConstArrayView<FSimpleMeshSectionSnapshotPtr> Sources, int32 MaxTriangles, float MinTriangleArea);
+}
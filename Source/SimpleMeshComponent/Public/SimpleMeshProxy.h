@@ -46,6 +46,8 @@ SOFTWARE.
 #include "DynamicMeshBuilder.h"
 #include "StaticMeshResources.h"
 #include "RayTracingInstance.h"
+#include "SimpleMeshBufferPool.h"
+#include "SimpleMeshOccluder.h"
 #if ENGINE_MAJOR_VERSION==4
 #include "TessellationRendering.h"
 #endif
@@ -63,9 +65,71 @@ struct FSimpleMeshSectionOptions
 	uint32 bIsMainPassRenderable : 1;
 	uint32 bCastsShadow : 1;
 	uint32 bShouldRenderStatic : 1;
+	/** Drawn in the shadow depth passes only, as the stand-in of another section */
+	uint32 bIsShadowOnly : 1;
 
 	FSimpleMeshSectionOptions() : bIsValid(false), bIsVisible(false), bIsMainPassRenderable(false),
-		bCastsShadow(false), bShouldRenderStatic(false){}
+		bCastsShadow(false), bShouldRenderStatic(false), bIsShadowOnly(false){}
+};
+
+/**
+ *	GPU buffers of a section, refcounted so they can outlive the proxy: a section that released its CPU geometry keeps them
+ *	on its component (FSimpleMeshSection::RenderBuffers) and the proxies created later draw from them.
+ *	The last reference may go on any thread, the resources are always released on the render thread.
+ */
+class FSimpleMeshSectionBuffers
+{
+public:
+	FSimpleMeshPooledPositionBuffer PositionBuffer;
+	FStaticMeshVertexBuffer StaticMeshVertexBuffer;
+	FColorVertexBuffer ColorVertexBuffer;
+	FSimpleMeshPooledIndexBuffer IndexBuffer;
+	int NumPrimitives = 0;
+
+	static TSharedPtr<FSimpleMeshSectionBuffers, ESPMode::ThreadSafe> Create()
+	{
+		return TSharedPtr<FSimpleMeshSectionBuffers, ESPMode::ThreadSafe>(new FSimpleMeshSectionBuffers(), [](FSimpleMeshSectionBuffers* Buffers)
+		{
+			if (IsInRenderingThread())
+			{
+				delete Buffers;
+				return;
+			}
+			ENQUEUE_RENDER_COMMAND(DeleteSimpleMeshSectionBuffers)([Buffers](FRHICommandListImmediate& RHICmdList)
+			{
+				delete Buffers;
+			});
+		});
+	}
+
+	/** Once for all the sections sharing the buffers */
+	void InitResources_RenderThread(FRHICommandListImmediate& RHICmdList)
+	{
+		if (bInitialized)
+		{
+			return;
+		}
+		bInitialized = true;
+
+		PositionBuffer.InitResource(RHICmdList);
+		StaticMeshVertexBuffer.InitResource(RHICmdList);
+		ColorVertexBuffer.InitResource(RHICmdList);
+		IndexBuffer.InitResource(RHICmdList);
+	}
+
+	~FSimpleMeshSectionBuffers()
+	{
+		PositionBuffer.ReleaseResource();
+		StaticMeshVertexBuffer.ReleaseResource();
+		ColorVertexBuffer.ReleaseResource();
+		IndexBuffer.ReleaseResource();
+	}
+
+private:
+	FSimpleMeshSectionBuffers() = default;
+
+	/** Render thread only */
+	bool bInitialized = false;
 };
 
 class FSimpleMeshSceneSection
@@ -75,34 +139,49 @@ public:
 	int MaxVertex = 0;
 	int LODIndex = 0;
 	UMaterialInterface* Material = nullptr;
-	FStaticMeshVertexBuffers VertexBuffers;
-	FDynamicMeshIndexBuffer32 IndexBuffer;
+	/** Owned with the component once the section released its CPU geometry, the references below point into it */
+	TSharedPtr<FSimpleMeshSectionBuffers, ESPMode::ThreadSafe> Buffers;
+	FSimpleMeshPooledPositionBuffer& PositionBuffer;
+	FStaticMeshVertexBuffer& StaticMeshVertexBuffer;
+	FColorVertexBuffer& ColorVertexBuffer;
+	FSimpleMeshPooledIndexBuffer& IndexBuffer;
 	FLocalVertexFactory VertexFactory;
 	FSimpleMeshSectionOptions Options;
+	/** Low poly stand-in drawn in the shadow passes instead of this section, owned */
+	FSimpleMeshSceneSection* ShadowSection = nullptr;
 #if RHI_RAYTRACING
 	FRayTracingGeometry RayTracingGeometry;
 #endif
 
+	/**
+	 *	With bDeferResourceInit nothing is enqueued: the section is CPU side only and may be built on any thread,
+	 *	the owner calls InitResources_RenderThread (batched for a whole proxy) before it is drawn.
+	 */
 	FSimpleMeshSceneSection(TArray<FDynamicMeshVertex>& InVertexBuffer, TArray<uint32>& InIndexBuffer,
 	                                 UMaterialInterface* InMaterial, FSimpleMeshSectionOptions InOptions,
-	                                 ERHIFeatureLevel::Type InFeatureLevel, int InLODIndex = 0, uint8 MaxTexcoords = MAX_TEXCOORDS)
-		: VertexFactory(InFeatureLevel, "FSimpleMeshSceneSection")
+	                                 ERHIFeatureLevel::Type InFeatureLevel, int InLODIndex = 0, uint8 MaxTexcoords = MAX_TEXCOORDS,
+	                                 bool bDeferResourceInit = false)
+		: FSimpleMeshSceneSection(FSimpleMeshSectionBuffers::Create(), InFeatureLevel)
 	{
 		Options = InOptions;	
 		
 		IndexBuffer.Indices = InIndexBuffer;
-		VertexBuffers.InitFromDynamicVertex(&VertexFactory, InVertexBuffer, MaxTexcoords);
+		InitVertexBuffers(InVertexBuffer, MaxTexcoords);
 		NumPrimitives = IndexBuffer.Indices.Num() / 3;
-		MaxVertex = VertexBuffers.PositionVertexBuffer.GetNumVertices()-1;
+		Buffers->NumPrimitives = NumPrimitives;
+		MaxVertex = PositionBuffer.GetNumVertices()-1;
 		LODIndex = InLODIndex;
 
 		CheckValidity();
 
-		BeginInitResource(&VertexBuffers.PositionVertexBuffer);
-		BeginInitResource(&VertexBuffers.StaticMeshVertexBuffer);
-		BeginInitResource(&VertexBuffers.ColorVertexBuffer);
-		BeginInitResource(&IndexBuffer);
-		BeginInitResource(&VertexFactory);
+		if (!bDeferResourceInit)
+		{
+			FSimpleMeshSceneSection* Self = this;
+			ENQUEUE_RENDER_COMMAND(InitSimpleMeshSceneSection)([Self](FRHICommandListImmediate& RHICmdList)
+			{
+				Self->InitResources_RenderThread(RHICmdList);
+			});
+		}
 	
 		if (InMaterial == NULL)
 			Material = UMaterial::GetDefaultMaterial(MD_Surface);
@@ -130,7 +209,7 @@ public:
 //				RayTracingGeometry.Initializer.TotalPrimitiveCount = IndexBuffer.Indices.Num() / 3;
 //
 //				FRayTracingGeometrySegment Segment;
-//				Segment.VertexBuffer = VertexBuffers.PositionVertexBuffer.VertexBufferRHI;
+//				Segment.VertexBuffer = PositionBuffer.VertexBufferRHI;
 //				Segment.NumPrimitives = RayTracingGeometry.Initializer.TotalPrimitiveCount;
 //				RayTracingGeometry.Initializer.Segments.Add(Segment);
 //
@@ -140,12 +219,34 @@ public:
 //#endif
 	}
 
+	/** Draw the buffers of a section built before, uploaded already: only the vertex factory is new. Same threading as above. */
+	FSimpleMeshSceneSection(TSharedPtr<FSimpleMeshSectionBuffers, ESPMode::ThreadSafe> InBuffers, UMaterialInterface* InMaterial,
+	                                 FSimpleMeshSectionOptions InOptions, ERHIFeatureLevel::Type InFeatureLevel, int InLODIndex = 0,
+	                                 bool bDeferResourceInit = false)
+		: FSimpleMeshSceneSection(MoveTemp(InBuffers), InFeatureLevel)
+	{
+		Options = InOptions;
+		NumPrimitives = Buffers->NumPrimitives;
+		MaxVertex = PositionBuffer.GetNumVertices()-1;
+		LODIndex = InLODIndex;
+		Options.bIsValid = PositionBuffer.GetNumVertices() >= 3 && NumPrimitives > 0;
+		Material = InMaterial ? InMaterial : UMaterial::GetDefaultMaterial(MD_Surface);
+
+		if (!bDeferResourceInit)
+		{
+			FSimpleMeshSceneSection* Self = this;
+			ENQUEUE_RENDER_COMMAND(InitSimpleMeshSceneSection)([Self](FRHICommandListImmediate& RHICmdList)
+			{
+				Self->InitResources_RenderThread(RHICmdList);
+			});
+		}
+	}
+
 	~FSimpleMeshSceneSection()
 	{
-		VertexBuffers.PositionVertexBuffer.ReleaseResource();
-		VertexBuffers.StaticMeshVertexBuffer.ReleaseResource();
-		VertexBuffers.ColorVertexBuffer.ReleaseResource();
-		IndexBuffer.ReleaseResource();
+		delete ShadowSection;
+
+		// The buffers go with their last section, or with the component keeping them
 		VertexFactory.ReleaseResource();
 
 #if RHI_RAYTRACING
@@ -156,6 +257,21 @@ public:
 #endif
 	}
 	
+	/** Positions and indices come from the shared buffer pool, the vertex factory is bound by hand */
+	void InitResources_RenderThread(FRHICommandListImmediate& RHICmdList)
+	{
+		Buffers->InitResources_RenderThread(RHICmdList);
+
+		FLocalVertexFactory::FDataType Data;
+		PositionBuffer.Bind(Data);
+		StaticMeshVertexBuffer.BindTangentVertexBuffer(&VertexFactory, Data);
+		StaticMeshVertexBuffer.BindPackedTexCoordVertexBuffer(&VertexFactory, Data);
+		StaticMeshVertexBuffer.BindLightMapVertexBuffer(&VertexFactory, Data, 0);
+		ColorVertexBuffer.BindColorVertexBuffer(&VertexFactory, Data);
+		VertexFactory.SetData(RHICmdList, Data);
+		VertexFactory.InitResource(RHICmdList);
+	}
+
 	FORCEINLINE bool CanRender() const 
 	{
 		return Options.bIsValid;
@@ -169,16 +285,50 @@ public:
 	FORCEINLINE bool ShouldRenderStaticPath() const { return ShouldRender() && ShouldRenderMainPass() && IsStaticSection(); }
 	FORCEINLINE bool ShouldRenderDynamicPath() const { return ShouldRender() && ShouldRenderMainPass() && !IsStaticSection(); }
 	FORCEINLINE bool ShouldRenderShadow() const { return ShouldRender() && Options.bCastsShadow; }
+	FORCEINLINE bool ShouldRenderShadowSection() const { return ShadowSection != nullptr && ShouldRenderShadow(); }
 
 	FORCEINLINE bool ShouldRenderDynamicPathRayTracing() const { return ShouldRender(); }
 
 
+	/** Same layout as FStaticMeshVertexBuffers::InitFromDynamicVertex, positions excepted */
+	void InitVertexBuffers(const TArray<FDynamicMeshVertex>& Vertices, uint32 NumTexCoords)
+	{
+		const int32 NumVertices = Vertices.Num();
+		PositionBuffer.Init(Vertices);
+
+		// Never read back, partial updates go straight to the RHI buffers: the CPU copies are freed once uploaded
+		StaticMeshVertexBuffer.Init(NumVertices, NumTexCoords, false);
+		ColorVertexBuffer.Init(NumVertices, false);
+
+		for (int32 VertIdx = 0; VertIdx < NumVertices; VertIdx++)
+		{
+			const FDynamicMeshVertex& Vertex = Vertices[VertIdx];
+			StaticMeshVertexBuffer.SetVertexTangents(VertIdx, Vertex.TangentX.ToFVector3f(), Vertex.GetTangentY(), Vertex.TangentZ.ToFVector3f());
+			for (uint32 UVIdx = 0; UVIdx < NumTexCoords; UVIdx++)
+			{
+				StaticMeshVertexBuffer.SetVertexUV(VertIdx, UVIdx, Vertex.TextureCoordinate[UVIdx]);
+			}
+			ColorVertexBuffer.VertexColor(VertIdx) = Vertex.Color;
+		}
+	}
+
 	void CheckValidity()
 	{
 		Options.bIsValid = true;
-		Options.bIsValid &= VertexBuffers.PositionVertexBuffer.GetNumVertices() >= 3;
+		Options.bIsValid &= PositionBuffer.GetNumVertices() >= 3;
 		Options.bIsValid &= IndexBuffer.Indices.Num() >= 3 && (IndexBuffer.Indices.Num() % 3)==0;
 	}
+
+private:
+	FSimpleMeshSceneSection(TSharedPtr<FSimpleMeshSectionBuffers, ESPMode::ThreadSafe> InBuffers, ERHIFeatureLevel::Type InFeatureLevel)
+		: Buffers(MoveTemp(InBuffers))
+		, PositionBuffer(Buffers->PositionBuffer)
+		, StaticMeshVertexBuffer(Buffers->StaticMeshVertexBuffer)
+		, ColorVertexBuffer(Buffers->ColorVertexBuffer)
+		, IndexBuffer(Buffers->IndexBuffer)
+		, VertexFactory(InFeatureLevel, "FSimpleMeshSceneSection")
+	{
+	}
 };
 
 class FSimpleMeshSceneProxy: public FPrimitiveSceneProxy
@@ -190,6 +340,9 @@ protected:
 	uint32 bShouldRenderStatic : 1;
 	uint32 bAnyMaterialUsesDithering : 1;
 
+	/** Read by the software occlusion, swapped on the render thread */
+	TSharedPtr<FSimpleMeshOccluderData, ESPMode::ThreadSafe> OccluderData;
+
 public:
 	size_t GetTypeHash() const override
 	{
@@ -225,7 +378,9 @@ public:
 		const auto FeatureLevel = GetScene().GetFeatureLevel();
 		for (int x = 0, xc = Sections.Num(); x < xc; x++)
 		{
-			check(Sections[x]!=nullptr);
+			// Free section slots have no render data
+			if (Sections[x] == nullptr)
+				continue;
 			auto &Section = *(Sections[x]);
 			check(Section.Material);
 			check(Section.CanRender());
@@ -235,6 +390,131 @@ public:
 		}
 	}
 
+	/** Replace the render data of one section slot (null frees it), the other sections are left untouched. */
+	void SetSection_RenderThread(int32 SectionIndex, FSimpleMeshSceneSection* NewSection)
+	{
+		check(IsInRenderingThread());
+
+		if (SectionIndex >= Sections.Num())
+		{
+			Sections.AddZeroed(SectionIndex + 1 - Sections.Num());
+		}
+
+		delete Sections[SectionIndex];
+		Sections[SectionIndex] = NewSection;
+
+		// Trailing free slots are not worth iterating
+		while (Sections.Num() > 0 && Sections.Last() == nullptr)
+		{
+			Sections.Pop(false);
+		}
+
+		if (NewSection != nullptr)
+		{
+			const auto FeatureLevel = GetScene().GetFeatureLevel();
+			MaterialRelevance |= NewSection->Material->GetRelevance(FeatureLevel);
+			bAnyMaterialUsesDithering |= NewSection->Material->IsDitheredLODTransition();
+		}
+
+		// Cached static draw commands still point at the old section
+		GetScene().UpdateCachedRenderStates(this);
+	}
+
+	/** Show or hide the render data of a section, its buffers are kept */
+	void SetSectionVisibility_RenderThread(int32 SectionIndex, bool bVisible)
+	{
+		check(IsInRenderingThread());
+
+		if (!Sections.IsValidIndex(SectionIndex) || Sections[SectionIndex] == nullptr || Sections[SectionIndex]->Options.bIsVisible == bVisible)
+		{
+			return;
+		}
+
+		Sections[SectionIndex]->Options.bIsVisible = bVisible;
+
+		// Static draw commands were cached with the previous visibility
+		if (bShouldRenderStatic)
+		{
+			GetScene().UpdateCachedRenderStates(this);
+		}
+	}
+
+	void SetSectionCastShadow_RenderThread(int32 SectionIndex, bool bCastShadow)
+	{
+		check(IsInRenderingThread());
+
+		if (!Sections.IsValidIndex(SectionIndex) || Sections[SectionIndex] == nullptr || Sections[SectionIndex]->Options.bCastsShadow == bCastShadow)
+		{
+			return;
+		}
+
+		Sections[SectionIndex]->Options.bCastsShadow = bCastShadow;
+		GetScene().UpdateCachedRenderStates(this);
+	}
+
+	/** Replace the shadow stand-in of a section (null removes it), the section itself is kept */
+	void SetSectionShadow_RenderThread(int32 SectionIndex, FSimpleMeshSceneSection* NewShadowSection)
+	{
+		check(IsInRenderingThread());
+
+		if (!Sections.IsValidIndex(SectionIndex) || Sections[SectionIndex] == nullptr)
+		{
+			delete NewShadowSection;
+			return;
+		}
+
+		delete Sections[SectionIndex]->ShadowSection;
+		Sections[SectionIndex]->ShadowSection = NewShadowSection;
+		GetScene().UpdateCachedRenderStates(this);
+	}
+
+	/** Overwrite the GPU positions of a run of vertices of a section, only that byte range of the buffer is locked. */
+	void UpdateSectionPositions_RenderThread(int32 SectionIndex, int32 FirstVertex, TConstArrayView<FVector3f> Positions)
+	{
+		check(IsInRenderingThread());
+
+		if (!Sections.IsValidIndex(SectionIndex) || Sections[SectionIndex] == nullptr)
+		{
+			return;
+		}
+
+		FSimpleMeshPooledPositionBuffer& PositionBuffer = Sections[SectionIndex]->PositionBuffer;
+		if (Positions.Num() == 0 || FirstVertex < 0 || FirstVertex + Positions.Num() > (int32)PositionBuffer.GetNumVertices() || !PositionBuffer.VertexBufferRHI.IsValid())
+		{
+			return;
+		}
+
+		const uint32 NumBytes = Positions.Num() * sizeof(FVector3f);
+		void* Data = RHILockBuffer(PositionBuffer.VertexBufferRHI, FirstVertex * sizeof(FVector3f), NumBytes, RLM_WriteOnly);
+		FMemory::Memcpy(Data, Positions.GetData(), NumBytes);
+		RHIUnlockBuffer(PositionBuffer.VertexBufferRHI);
+	}
+
+	/** Overwrite the packed tangent frames (TangentX, TangentZ pairs) of a run of vertices of a section. */
+	void UpdateSectionTangents_RenderThread(int32 SectionIndex, int32 FirstVertex, TConstArrayView<FPackedNormal> TangentPairs)
+	{
+		check(IsInRenderingThread());
+
+		if (!Sections.IsValidIndex(SectionIndex) || Sections[SectionIndex] == nullptr)
+		{
+			return;
+		}
+
+		// Sections are always built with the default precision, two FPackedNormal per vertex
+		FStaticMeshVertexBuffer& TangentBuffer = Sections[SectionIndex]->StaticMeshVertexBuffer;
+		const int32 NumVertices = TangentPairs.Num() / 2;
+		if (NumVertices == 0 || TangentBuffer.GetUseHighPrecisionTangentBasis() || FirstVertex < 0 || FirstVertex + NumVertices > (int32)TangentBuffer.GetNumVertices()
+			|| !TangentBuffer.TangentsVertexBuffer.VertexBufferRHI.IsValid())
+		{
+			return;
+		}
+
+		const uint32 Stride = 2 * sizeof(FPackedNormal);
+		void* Data = RHILockBuffer(TangentBuffer.TangentsVertexBuffer.VertexBufferRHI, FirstVertex * Stride, NumVertices * Stride, RLM_WriteOnly);
+		FMemory::Memcpy(Data, TangentPairs.GetData(), NumVertices * Stride);
+		RHIUnlockBuffer(TangentBuffer.TangentsVertexBuffer.VertexBufferRHI);
+	}
+
 	void CreateMeshBatch(FMeshBatch& MeshBatch, const FSimpleMeshSceneSection& Section, int32 SectionId, FMaterialRenderProxy* WireframeMaterial, bool bForRayTracing) const
 	{
 		SCOPE_CYCLE_COUNTER(STAT_SimpleMeshSceneProxy_CreateMeshBatch);
@@ -253,7 +533,19 @@ public:
 		check(Section.VertexFactory.IsInitialized());
 		MeshBatch.VertexFactory = &Section.VertexFactory;
 		MeshBatch.Type = PT_TriangleList;
-		MeshBatch.CastShadow = Section.ShouldRenderShadow();
+		if (Section.Options.bIsShadowOnly)
+		{
+			// Invisible to every pass but the shadow depths
+			MeshBatch.CastShadow = true;
+			MeshBatch.bUseForMaterial = false;
+			MeshBatch.bUseForDepthPass = false;
+			MeshBatch.bUseAsOccluder = false;
+		}
+		else
+		{
+			// A section with a shadow stand-in leaves the shadows to it
+			MeshBatch.CastShadow = Section.ShouldRenderShadow() && Section.ShadowSection == nullptr;
+		}
 
 		MeshBatch.LODIndex = Section.LODIndex;
 	#if !(UE_BUILD_SHIPPING || UE_BUILD_TEST)
@@ -305,6 +597,30 @@ public:
 		return !MaterialRelevance.bDisableDepthTest;
 	}
 
+	int32 GetOccluderData(FOccluderVertexArraySP& OutVertices, FOccluderIndexArraySP& OutIndices) const override
+	{
+		if (OccluderData.IsValid())
+		{
+			OutVertices = OccluderData->VerticesSP;
+			OutIndices = OccluderData->IndicesSP;
+			return OccluderData->IndicesSP->Num();
+		}
+		return 0;
+	}
+
+	void SetOccluderData_RenderThread(TSharedPtr<FSimpleMeshOccluderData, ESPMode::ThreadSafe> NewOccluderData)
+	{
+		check(IsInRenderingThread());
+		OccluderData = MoveTemp(NewOccluderData);
+	}
+
+	/** The component swapped its body setup after a cook, the previous one is only emptied once this ran */
+	void SetBodySetup_RenderThread(UBodySetup* NewBodySetup)
+	{
+		check(IsInRenderingThread());
+		BodySetup = NewBodySetup;
+	}
+
 	uint32 GetMemoryFootprint(void) const override
 	{
 		return(sizeof(*this) + GetAllocatedSize());
@@ -316,6 +632,8 @@ public:
 
 		for (int SectionIndex = 0, SectionIndexCnt = Sections.Num(); SectionIndex < SectionIndexCnt; SectionIndex++)
 		{
+			if (Sections[SectionIndex] == nullptr)
+				continue;
 			auto &Section = *(Sections[SectionIndex]);
 						
 			if (Section.ShouldRenderStaticPath() && bShouldRenderStatic)
@@ -327,6 +645,16 @@ public:
 				CreateMeshBatch(MeshBatch, Section, SectionIndex, nullptr, false);
 				PDI->DrawMesh(MeshBatch, 1.f);
 			}
+
+			if (Section.ShouldRenderShadowSection() && Section.IsStaticSection() && bShouldRenderStatic)
+			{
+				FMeshBatch ShadowMeshBatch;
+				ShadowMeshBatch.LODIndex = Section.LODIndex;
+				ShadowMeshBatch.SegmentIndex = SectionIndex;
+
+				CreateMeshBatch(ShadowMeshBatch, *Section.ShadowSection, SectionIndex, nullptr, false);
+				PDI->DrawMesh(ShadowMeshBatch, 1.f);
+			}
 		}
 	}
 
@@ -358,8 +686,10 @@ public:
 				{
 					for (int SectionIndex = 0, SectionIndexCnt = Sections.Num(); SectionIndex < SectionIndexCnt; SectionIndex++)
 					{
+						if (Sections[SectionIndex] == nullptr)
+							continue;
 						auto &Section = *(Sections[SectionIndex]);
-						if (Section.ShouldRenderDynamicPath() || bForceDynamicPath)
+						if (Section.ShouldRenderDynamicPath() || (bForceDynamicPath && Section.ShouldRender() && Section.ShouldRenderMainPass()))
 						{
 							FMeshBatch& MeshBatch = Collector.AllocateMesh();
 							CreateMeshBatch(MeshBatch, Section, SectionIndex, WireframeMaterialInstance, false);
@@ -369,6 +699,13 @@ public:
 
 							Collector.AddMesh(ViewIndex, MeshBatch);
 						}
+
+						if (Section.ShouldRenderShadowSection() && !bWireframe)
+						{
+							FMeshBatch& ShadowMeshBatch = Collector.AllocateMesh();
+							CreateMeshBatch(ShadowMeshBatch, *Section.ShadowSection, SectionIndex, nullptr, false);
+							Collector.AddMesh(ViewIndex, ShadowMeshBatch);
+						}
 					}
 				}
 			}
@@ -408,6 +745,8 @@ public:
 
 		for (int SectionIndex = 0, SectionIndexCnt = Sections.Num(); SectionIndex < SectionIndexCnt; SectionIndex++)
 		{
+			if (Sections[SectionIndex] == nullptr)
+				continue;
 			auto &Section = *(Sections[SectionIndex]);
 						
 			if (Section.ShouldRenderDynamicPathRayTracing())
@@ -0,0 +1,61 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHSERIALIZATION---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHSERIALIZATION---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/Guid.h"
+
+struct FSimpleMeshSection;
+
+/** Custom serialization version for USimpleMeshComponent */
+struct SIMPLEMESHCOMPONENT_API FSimpleMeshCustomVersion
+{
+    enum Type
+    {
+        // Before any version changes were made
+        BeforeCustomVersionWasAdded = 0,
+
+        // Section geometry is saved as a packed section blob
+        SerializedSectionBlob,
+
+        // -----<new versions can be added above this line>-------------------------------------------------
+        VersionPlusOne,
+        LatestVersion = VersionPlusOne - 1
+    };
+
+    // The GUID for this custom version number
+    const static FGuid GUID;
+
+private:
+    FSimpleMeshCustomVersion() {}
+};
+
+/**
+ *	Packed, aligned binary image of a set of sections.
+ *	Layout: header, one table entry per section, then for each section its positions, tangents and indices, every block
+ *	starting on a BlobAlignment boundary. Everything goes through FArchive, and the header carries the blob version.
+ *	Positions can be quantized to 16 bits inside the section box, and indices are stored on 16 bits when the section is
+ *	small enough.
+ */
+namespace SimpleMeshSerialization
+{
+    /** Every block of the blob starts on this boundary */
+    static constexpr uint32 BlobAlignment = 16;
+
+    /** Write the sections into a blob. SectionIndices gives the index each section is restored at. */
+    SIMPLEMESHCOMPONENT_API void WriteSections(TConstArrayView<const FSimpleMeshSection*> Sections, TConstArrayView<int32> SectionIndices, bool bQuantizePositions, TArray<uint8>& OutBlob);
+
+    /** Highest section index a blob may hold, guards against allocating a huge slot range from corrupt data */
+    static constexpr int32 MaxSectionIndex = 1 << 20;
+
+    /** Decode a blob, in parallel, into sections. Each section is restored in its own slot. Fails, with no sections, on out of range offsets or indices. */
+    SIMPLEMESHCOMPONENT_API bool ReadSections(TConstArrayView<uint8> Blob, TSparseArray<FSimpleMeshSection>& OutSections);
+
+    /** Serialize a blob to an archive, optionally compressed. On load a size larger than the archive can hold sets the archive error. */
+    SIMPLEMESHCOMPONENT_API void SerializeBlob(FArchive& Ar, TArray<uint8>& Blob, bool bCompress);
+}
@@ -0,0 +1,31 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHSIMPLIFY---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHSIMPLIFY---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace SimpleMeshSimplify
+{
+    /**
+     *	Decimate a triangle mesh by quadric edge collapses, for collision.
+     *	Vertices sharing a position are merged first, so hard edges and UV seams do not stop the collapses.
+     *	Edges are collapsed onto one of their vertices, cheapest first, while the squared distances of the kept vertex
+     *	to the planes of the triangles it absorbed stay within the budget. Open borders are kept as they are, so sections
+     *	that touch keep touching, and collapses that would flip a triangle are skipped. Winding is preserved.
+     *	Safe on any thread.
+     *	@param	MaxError		Distance the surface may move, in the units of the positions.
+     *	@return					Number of triangles of the result.
+     */
+    SIMPLEMESHCOMPONENT_API int32 SimplifyMesh(TConstArrayView<FVector3f> Positions, TConstArrayView<uint32> Indices, float MaxError, TArray<FVector3f>& OutPositions, TArray<uint32>& OutIndices);
+
+    /**
+     *	Largest distance between two surfaces, measured both ways from the corners, edge midpoints and centers of the triangles.
+     *	@param	SearchDistance	Points with nothing closer on the other surface count as this far.
+     */
+    SIMPLEMESHCOMPONENT_API float ComputeMaxDeviation(TConstArrayView<FVector3f> PositionsA, TConstArrayView<uint32> IndicesA, TConstArrayView<FVector3f> PositionsB, TConstArrayView<uint32> IndicesB, float SearchDistance);
+}
@@ -0,0 +1,51 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHSNAPSHOT---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHSNAPSHOT---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FSimpleMeshSection;
+
+/** Immutable copy of the geometry of one section, safe to read from any thread for as long as it is referenced */
+struct FSimpleMeshSectionSnapshot
+{
+    int32 SectionIndex = INDEX_NONE;
+
+    /** Publication this copy was made for, sections that did not change keep their older copy */
+    uint32 Version = 0;
+
+    TArray<FVector3f> Positions;
+    TArray<uint32> Indices;
+    FBox LocalBox = FBox(ForceInit);
+    int32 MaterialIndex = 0;
+    bool bVisible = true;
+    bool bEnableCollision = false;
+};
+
+typedef TSharedPtr<const FSimpleMeshSectionSnapshot, ESPMode::ThreadSafe> FSimpleMeshSectionSnapshotPtr;
+
+/** Every section of a component at one point in time */
+struct FSimpleMeshSnapshot
+{
+    /** Grows with every publication of the component */
+    uint32 Version = 0;
+
+    /** Transform of the component when the snapshot was published */
+    FTransform ComponentToWorld;
+
+    /** Indexed by section slot, null for free slots */
+    TArray<FSimpleMeshSectionSnapshotPtr> Sections;
+};
+
+typedef TSharedPtr<const FSimpleMeshSnapshot, ESPMode::ThreadSafe> FSimpleMeshSnapshotPtr;
+
+namespace SimpleMeshSnapshot
+{
+    /** Copy the positions and indices of a section, released sections included */
+    SIMPLEMESHCOMPONENT_API FSimpleMeshSectionSnapshotPtr MakeSectionSnapshot(const FSimpleMeshSection& Section, int32 SectionIndex, uint32 Version);
+}
@@ -0,0 +1,105 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHVOXEL---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHVOXEL---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "SimpleMeshVoxel.generated.h"
+
+struct FSimpleMeshSection;
+
+/** How a voxel grid is turned into triangles */
+
+UENUM(BlueprintType)
+enum class ESimpleMeshVoxelMode : uint8
+{
+    /** Cube voxels, coplanar faces of the same material are merged into larger quads */
+    Greedy,
+
+    /** Smooth surface through the 0 density level, for terrain */
+    SurfaceNets,
+};
+
+/**
+ *	Dense density/material samples of one chunk.
+ *	The grid has a one sample apron on every side, copied from the neighbour chunks: only the inner samples produce geometry,
+ *	the apron is read so chunks of (Size - 2) samples placed every (Size - 2) * VoxelSize meet without cracks.
+ */
+
+USTRUCT(BlueprintType)
+struct SIMPLEMESHCOMPONENT_API FSimpleMeshVoxelGrid
+{
+    GENERATED_BODY()
+public:
+
+    /** Samples per axis, apron included */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|SimpleMesh")
+        FIntVector Size;
+
+    /** Distance between two samples */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|SimpleMesh", meta = (ClampMin = "0.001"))
+        float VoxelSize;
+
+    /** Density of every sample, X varies fastest. Above 0 is solid. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|SimpleMesh")
+        TArray<float> Densities;
+
+    /** Material slot of every sample, read for solid samples only. Empty means slot 0 everywhere. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voxel|SimpleMesh")
+        TArray<uint8> Materials;
+
+    FSimpleMeshVoxelGrid()
+        : Size(0, 0, 0)
+        , VoxelSize(100.f)
+    {}
+
+    /** Allocate an empty (all air, slot 0) grid */
+    void Init(const FIntVector& InSize, float InVoxelSize)
+    {
+        Size = InSize;
+        VoxelSize = InVoxelSize;
+        Densities.Init(-1.f, InSize.X * InSize.Y * InSize.Z);
+        Materials.Init(0, InSize.X * InSize.Y * InSize.Z);
+    }
+
+    FORCEINLINE int32 GetIndex(int32 X, int32 Y, int32 Z) const
+    {
+        return X + Size.X * (Y + Size.Y * Z);
+    }
+
+    FORCEINLINE void Set(int32 X, int32 Y, int32 Z, float Density, uint8 Material)
+    {
+        const int32 Index = GetIndex(X, Y, Z);
+        Densities[Index] = Density;
+        if (Materials.Num() > 0)
+        {
+            Materials[Index] = Material;
+        }
+    }
+
+    /** At least one inner sample per axis and arrays of the right size */
+    bool IsValid() const
+    {
+        const int32 NumSamples = Size.X * Size.Y * Size.Z;
+        return Size.X >= 3 && Size.Y >= 3 && Size.Z >= 3 && VoxelSize > 0.f
+            && Densities.Num() == NumSamples && (Materials.Num() == 0 || Materials.Num() == NumSamples);
+    }
+};
+
+namespace SimpleMeshVoxel
+{
+    /**
+     *	Mesh a grid straight into sections, one per material slot: OutSections[Slot] is empty if the slot is not used.
+     *	Slices of the grid are meshed in parallel. Vertices come with their normals, bGenerateNormals is left off.
+     *	Thread safe, the first inner sample is at the origin of the section space.
+     */
+    SIMPLEMESHCOMPONENT_API void MeshGrid(const FSimpleMeshVoxelGrid& Grid, ESimpleMeshVoxelMode Mode, TArray<FSimpleMeshSection>& OutSections);
+
+    /** Mesh several chunks in parallel, e.g. the allocated chunks of a sparse world. OutSections[i] are the sections of Grids[i]. */
+    SIMPLEMESHCOMPONENT_API void MeshGrids(TConstArrayView<const FSimpleMeshVoxelGrid*> Grids, ESimpleMeshVoxelMode Mode, TArray<TArray<FSimpleMeshSection>>& OutSections);
+}
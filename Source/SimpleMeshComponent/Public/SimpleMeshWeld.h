@@ -0,0 +1,25 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHWELD---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHWELD---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FSimpleMeshSection;
+
+namespace SimpleMeshWeld
+{
+    /**
+     *	Merge the vertices of a section closer than Tolerance, remap the indices and drop the triangles that collapsed.
+     *	Each vertex is merged into the lowest index vertex in range, so the result does not depend on thread timing.
+     *	Only positions are compared: the kept vertex wins for every other attribute, and merged vertices share their generated normal.
+     *	The section box is rebuilt from the kept vertices.
+     *	@param	Tolerance		Max distance between merged vertices, 0 only merges identical positions.
+     *	@return					Number of vertices removed.
+     */
+    SIMPLEMESHCOMPONENT_API int32 WeldSectionVertices(FSimpleMeshSection& Section, float Tolerance);
+}
@@ -33,8 +33,106 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Geometry Parameters")
         int32 NumDivisionsY = 16; // Valeur par dfaut
 
+    /** Taille du plan, en units locales */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Geometry Parameters")
+        FVector2D PlaneSize = FVector2D(100.0, 100.0);
+
+    /**
+     *	Replace the uniform grid by a quadtree of tiles, one component each, refined around the player view.
+     *	Each tile has its own body: a batch only cooks the collision of the tiles it rebuilt.
+     *	Tiles next to a coarser tile collapse every other vertex of that edge, so the seams stay closed.
+     *	Tiles are built on worker threads, only those whose LOD or seams changed, and swapped in all at once.
+     */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Quadtree LOD")
+        bool bUseQuadtreeLOD = false;
+
+    /** Quads along each side of a tile, at every LOD. Rounded to an even number. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Quadtree LOD", meta = (EditCondition = "bUseQuadtreeLOD", ClampMin = "2", ClampMax = "254"))
+        int32 TileResolution = 32;
+
+    /** Depth of the quadtree: the finest tiles are PlaneSize / 2^MaxLODLevel */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Quadtree LOD", meta = (EditCondition = "bUseQuadtreeLOD", ClampMin = "0", ClampMax = "16"))
+        int32 MaxLODLevel = 6;
+
+    /** A tile is split while the view is closer than its size times this */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Quadtree LOD", meta = (EditCondition = "bUseQuadtreeLOD", ClampMin = "0.5"))
+        float LODDistanceFactor = 2.f;
+
+    /** The tiles are selected again once the view moved this far */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Quadtree LOD", meta = (EditCondition = "bUseQuadtreeLOD", ClampMin = "0"))
+        float LODUpdateDistance = 100.f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "SMC | Quadtree LOD", meta = (EditCondition = "bUseQuadtreeLOD"))
+        bool bTileCollision = true;
+
     void InitializePlaneGeometry();
 
+    /**
+     *	Height of the plane at a local position, for the quadtree tiles. Called on worker threads: the sampler must own what it reads.
+     *	Flat when null.
+     */
+    virtual TFunction<float(double X, double Y)> MakeHeightSampler() const { return nullptr; }
+
+private:
+
+    /** Tile of the quadtree: level, then X and Y among the 2^Level tiles of a row */
+    static uint64 MakeTileKey(int32 Level, int32 X, int32 Y) { return ((uint64)Level << 48) | ((uint64)X << 24) | (uint64)Y; }
+
+    struct FLODTile
+    {
+        /** Component holding the tile in its section 0, with its own body */
+        USimpleMeshComponent* Component = nullptr;
+
+        /** Edges stitched to a coarser neighbor: -X, +X, -Y, +Y */
+        uint8 EdgeMask = 0;
+    };
+
+    /** Leaves of the quadtree refined around the view (local space), with the edge mask of each */
+    void SelectLODTiles(const FVector& LocalViewLocation, TMap<uint64, uint8>& OutTiles) const;
+
+    /** Build the tiles of the selection that changed on workers, see FinishLODTile */
+    void UpdateLODTiles(const FVector& LocalViewLocation);
+
+    /** Game thread end of a tile build: the section is added hidden until the whole batch is there */
+    void FinishLODTile(uint32 Serial, uint64 TileKey, uint8 EdgeMask, FSimpleMeshSection&& Section);
+
+    /** Show the tiles of the batch and remove the ones they replace */
+    void ApplyLODBatch();
+
+    void ResetLODTiles();
+
+    /** Player view in the space of the plane, the plane center without players */
+    FVector GetLocalViewLocation() const;
+
+    /** Tile component from the pool, or a new one attached to SimpleMeshComponent */
+    USimpleMeshComponent* AcquireTileComponent();
+
+    /** Clear a tile component and return it to the pool */
+    void ReleaseTileComponent(USimpleMeshComponent* Component);
+
+    /** The material of a slot, or its default when the slot is empty */
+    static UMaterialInterface* ResolveMaterial(UMaterialInterface* SlotMaterial, const TSoftObjectPtr<UMaterialInterface>& DefaultMaterial);
+
+    /** Tiles on screen */
+    TMap<uint64, FLODTile> LODTiles;
+
+    /** Selection being built, and the tiles of it already added */
+    TMap<uint64, uint8> BatchSelection;
+    TMap<uint64, FLODTile> BatchTiles;
+    int32 NumPendingTiles = 0;
+    uint32 LODBatchSerial = 0;
+
+    /** Components of the tiles on screen and being built, kept here for the garbage collector */
+    UPROPERTY(Transient)
+        TArray<TObjectPtr<USimpleMeshComponent>> TileComponents;
+
+    /** Components of replaced tiles, cleared and ready for the next batch */
+    UPROPERTY(Transient)
+        TArray<TObjectPtr<USimpleMeshComponent>> TileComponentPool;
+
+    FVector LastLODViewLocation = FVector::ZeroVector;
+    bool bLODTilesDirty = true;
+
 public:
 
     virtual void Tick(float DeltaTime) override;
@@ -49,4 +147,12 @@ public:
     UPROPERTY(EditAnywhere, Category = "SMC | Material")
         UMaterialInterface* MaterialSlot2;
 
+    /** Used when MaterialSlot1 is empty, loaded once */
+    UPROPERTY(EditAnywhere, Category = "SMC | Material")
+        TSoftObjectPtr<UMaterialInterface> DefaultMaterial1;
+
+    /** Used when MaterialSlot2 is empty, loaded once */
+    UPROPERTY(EditAnywhere, Category = "SMC | Material")
+        TSoftObjectPtr<UMaterialInterface> DefaultMaterial2;
+
 };
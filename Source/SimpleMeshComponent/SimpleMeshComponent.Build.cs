@@ -17,7 +17,15 @@ namespace UnrealBuildTool.Rules
                     "RenderCore",
                     "RHI",
                     "StaticMeshDescription",
-                    "PhysicsCore"
+                    "PhysicsCore",
+                    "Chaos"
+                }
+				);
+
+			PrivateDependencyModuleNames.AddRange(
+				new string[]
+				{
+                    "ImageWrapper"
                 }
 				);
 		}
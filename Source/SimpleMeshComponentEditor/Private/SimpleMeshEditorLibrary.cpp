@@ -0,0 +1,93 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHEDITORLIBRARY---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHEDITORLIBRARY---------//
+
+#include "SimpleMeshEditorLibrary.h"
+#include "SimpleMeshComponent.h"
+#include "SimpleMeshConversion.h"
+#include "MeshDescription.h"
+#include "Engine/StaticMesh.h"
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "Misc/PackageName.h"
+#include "UObject/Package.h"
+#include "UObject/SavePackage.h"
+
+#include UE_INLINE_GENERATED_CPP_BY_NAME(SimpleMeshEditorLibrary)
+
+DEFINE_LOG_CATEGORY_STATIC(LogSimpleMeshEditor, Log, All);
+
+UStaticMesh* USimpleMeshEditorLibrary::BakeToStaticMeshAsset(USimpleMeshComponent* Component, const FString& PackageName, bool bEnableNanite, bool bSaveAsset)
+{
+    FText Reason;
+    if (Component == nullptr || !FPackageName::IsValidLongPackageName(PackageName, false, &Reason))
+    {
+        UE_LOG(LogSimpleMeshEditor, Error, TEXT("BakeToStaticMeshAsset: invalid component or package name '%s' %s"), *PackageName, *Reason.ToString());
+        return nullptr;
+    }
+
+    FMeshDescription MeshDescription;
+    if (!SimpleMeshConversion::BuildMeshDescription(Component, MeshDescription))
+    {
+        UE_LOG(LogSimpleMeshEditor, Warning, TEXT("BakeToStaticMeshAsset: %s has no triangles to bake"), *Component->GetName());
+        return nullptr;
+    }
+
+    UPackage* Package = CreatePackage(*PackageName);
+    Package->FullyLoad();
+
+    // Rebaking keeps the asset and its references, only the geometry is replaced
+    const FString AssetName = FPackageName::GetLongPackageAssetName(PackageName);
+    UStaticMesh* StaticMesh = FindObject<UStaticMesh>(Package, *AssetName);
+    const bool bNewAsset = StaticMesh == nullptr;
+    if (bNewAsset)
+    {
+        StaticMesh = NewObject<UStaticMesh>(Package, *AssetName, RF_Public | RF_Standalone);
+    }
+    else
+    {
+        StaticMesh->Modify();
+    }
+
+    StaticMesh->PreEditChange(nullptr);
+
+    SimpleMeshConversion::GetStaticMaterials(Component, StaticMesh->GetStaticMaterials());
+
+    StaticMesh->SetNumSourceModels(1);
+    FStaticMeshSourceModel& SourceModel = StaticMesh->GetSourceModel(0);
+    SourceModel.BuildSettings.bRecomputeNormals = false;
+    SourceModel.BuildSettings.bRecomputeTangents = false;
+
+    StaticMesh->CreateMeshDescription(0, MoveTemp(MeshDescription));
+    StaticMesh->CommitMeshDescription(0);
+
+    StaticMesh->NaniteSettings.bEnabled = bEnableNanite;
+
+    SimpleMeshConversion::CopyCollision(Component, StaticMesh);
+
+    StaticMesh->Build(false);
+    StaticMesh->PostEditChange();
+    StaticMesh->MarkPackageDirty();
+
+    if (bNewAsset)
+    {
+        FAssetRegistryModule::AssetCreated(StaticMesh);
+    }
+
+    if (bSaveAsset)
+    {
+        const FString FileName = FPackageName::LongPackageNameToFilename(PackageName, FPackageName::GetAssetPackageExtension());
+
+        FSavePackageArgs SaveArgs;
+        SaveArgs.TopLevelFlags = RF_Public | RF_Standalone;
+        SaveArgs.SaveFlags = SAVE_NoError;
+        if (!UPackage::SavePackage(Package, StaticMesh, *FileName, SaveArgs))
+        {
+            UE_LOG(LogSimpleMeshEditor, Error, TEXT("BakeToStaticMeshAsset: failed to save %s"), *FileName);
+        }
+    }
+
+    return StaticMesh;
+}
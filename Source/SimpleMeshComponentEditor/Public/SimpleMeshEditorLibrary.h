@@ -0,0 +1,36 @@
+// Copyright Epic Games, Inc. All Rights Reserved.
+//---------SIMPLEMESHEDITORLIBRARY---------//
+// Licence: MIT License
+// Created by: BenjaCorp at iolaCorpStudio
+// Created at: 19/10/2026
+//---------SIMPLEMESHEDITORLIBRARY---------//
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+
+#include "SimpleMeshEditorLibrary.generated.h"
+
+class USimpleMeshComponent;
+class UStaticMesh;
+
+/** Editor side of the static mesh bake: writes the frozen geometry as an asset */
+
+UCLASS()
+class SIMPLEMESHCOMPONENTEDITOR_API USimpleMeshEditorLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+
+    /**
+     *	Bake the visible sections of a component into a static mesh asset, replacing the geometry of an existing one.
+     *	@param	Component			Component to bake.
+     *	@param	PackageName			Long package name of the asset, e.g. /Game/Baked/SM_Terrain.
+     *	@param	bEnableNanite		Build Nanite data for the asset.
+     *	@param	bSaveAsset			Save the package to disk, otherwise it is only marked dirty.
+     */
+    UFUNCTION(BlueprintCallable, Category = "Components|SimpleMesh")
+    static UStaticMesh* BakeToStaticMeshAsset(USimpleMeshComponent* Component, const FString& PackageName, bool bEnableNanite = false, bool bSaveAsset = true);
+};